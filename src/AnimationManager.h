@@ -3,26 +3,35 @@
 
 #include <Arduino.h>
 #include <U8g2lib.h>
+#include <type_traits>
 #include "config.h"
+#include "FixedPoint.h"
+#include "PixelKernels.h"
 
-// Forward declarations
-void debugPrint(int level, const char* format, ...);
+// Number type for particle and tween math, picked at compile time
+typedef std::conditional<USE_FIXED_POINT_MATH, Q16_16, float>::type AnimationScalar;
 
+// Step timer polled from the frame loop: due once more than interval has
+// passed since the last step (the test the hand-rolled timers used), and a
+// step restarts the interval from now. Polling marks the timer as live for
+// the scheduler below.
 class AnimationTimer {
 private:
     unsigned long lastUpdate;
     unsigned long interval;
     bool enabled;
+    bool polled;
 
 public:
     AnimationTimer(unsigned long intervalMs = 100) 
-        : lastUpdate(0), interval(intervalMs), enabled(true) {}
+        : lastUpdate(0), interval(intervalMs), enabled(true), polled(false) {}
     
     bool shouldUpdate() {
         if (!enabled) return false;
+        polled = true;
         
         unsigned long currentTime = millis();
-        if (currentTime - lastUpdate >= interval) {
+        if (currentTime - lastUpdate > interval) {
             lastUpdate = currentTime;
             return true;
         }
@@ -34,6 +43,15 @@ public:
     void disable() { enabled = false; }
     void reset() { lastUpdate = millis(); }
     
+    bool isEnabled() const { return enabled; }
+    unsigned long getElapsed() const { return millis() - lastUpdate; }
+    
+    // First millis() at which shouldUpdate() steps
+    unsigned long nextDue() const { return lastUpdate + interval + 1; }
+    
+    bool wasPolled() const { return polled; }
+    void clearPolled() { polled = false; }
+    
     // Get progress as a float between 0.0 and 1.0
     float getProgress() const {
         if (!enabled) return 0.0f;
@@ -42,20 +60,86 @@ public:
     }
 };
 
-class AnimationValue {
+// Next-deadline animation scheduler
+//
+// Knows when anything on screen changes next, so the frame loop can skip
+// rendering and the transfer until then. Every frame starts with
+// beginFrame(); the timers polled while rendering it are the live ones
+// (objects that are off the scene or culled don't poll theirs), and
+// animations that move on their own clock (particles, clips, Santa) ask
+// for a frame with wakeAt()/wakeNextFrame(). nextDue() is the earliest of
+// those deadlines, at most horizonMs ahead.
+//
+// A step that changes state but nothing visible (the banner ticker under
+// the hardware scroll) still counts: skipped frames don't catch up on
+// missed steps. There are only a handful of timers, a scan of the array
+// is cheaper here than keeping a heap ordered.
+template <uint8_t CAPACITY>
+class BasicAnimationScheduler {
+private:
+    AnimationTimer *timers[CAPACITY];
+    uint8_t count;
+    bool waking;
+    unsigned long wakeMs;
+
+public:
+    BasicAnimationScheduler() : count(0), waking(false), wakeMs(0) {}
+
+    // False when all CAPACITY slots are taken
+    bool add(AnimationTimer &timer) {
+        if (count >= CAPACITY) return false;
+        timers[count++] = &timer;
+        return true;
+    }
+
+    void beginFrame() {
+        for (uint8_t i = 0; i < count; i++) timers[i]->clearPolled();
+        waking = false;
+    }
+
+    // Something changes at ms without a timer of its own
+    void wakeAt(unsigned long ms) {
+        if (!waking || (long)(ms - wakeMs) < 0) wakeMs = ms;
+        waking = true;
+    }
+
+    void wakeNextFrame() { wakeAt(millis()); }
+
+    // Earliest deadline of this frame's live timers and wake requests
+    unsigned long nextDue(unsigned long now, unsigned long horizonMs) const {
+        unsigned long due = now + horizonMs;
+        for (uint8_t i = 0; i < count; i++) {
+            const AnimationTimer &timer = *timers[i];
+            if (!timer.wasPolled() || !timer.isEnabled()) continue;
+            if ((long)(timer.nextDue() - due) < 0) due = timer.nextDue();
+        }
+        if (waking && (long)(wakeMs - due) < 0) due = wakeMs;
+        return due;
+    }
+
+    uint8_t getTimerCount() const { return count; }
+};
+
+typedef BasicAnimationScheduler<ANIMATION_TIMER_SLOTS> AnimationScheduler;
+
+template <typename Scalar>
+class BasicAnimationValue {
 private:
-    float currentValue;
-    float targetValue;
-    float startValue;
-    float speed;
+    Scalar currentValue;
+    Scalar targetValue;
+    Scalar startValue;
+    Scalar speed;
     bool animating;
 
+    static constexpr Scalar SETTLE_DISTANCE = toScalar<Scalar>(0.01f);
+    static constexpr Scalar FRAME_SECONDS = toScalar<Scalar>(ANIMATION_FRAME_DELAY / 1000.0f);
+
 public:
-    AnimationValue(float initialValue = 0.0f) 
+    BasicAnimationValue(Scalar initialValue = Scalar(0)) 
         : currentValue(initialValue), targetValue(initialValue), 
-          startValue(initialValue), speed(1.0f), animating(false) {}
+          startValue(initialValue), speed(Scalar(1)), animating(false) {}
     
-    void animateTo(float target, float animationSpeed = 1.0f) {
+    void animateTo(Scalar target, Scalar animationSpeed = Scalar(1)) {
         startValue = currentValue;
         targetValue = target;
         speed = animationSpeed;
@@ -65,106 +149,154 @@ public:
     void update() {
         if (!animating) return;
         
-        float diff = targetValue - currentValue;
-        if (abs(diff) < 0.01f) {
+        Scalar diff = targetValue - currentValue;
+        if (scalarAbs(diff) < SETTLE_DISTANCE) {
             currentValue = targetValue;
             animating = false;
             return;
         }
         
-        currentValue += diff * speed * (ANIMATION_FRAME_DELAY / 1000.0f);
+        currentValue += diff * speed * FRAME_SECONDS;
     }
     
-    float getValue() const { return currentValue; }
+    Scalar getValue() const { return currentValue; }
     bool isAnimating() const { return animating; }
-    void setValue(float value) { 
+    void setValue(Scalar value) { 
         currentValue = value; 
         targetValue = value;
         animating = false;
     }
 };
 
-class ParticleSystem {
+typedef BasicAnimationValue<AnimationScalar> AnimationValue;
+
+// Particle pool
+//
+// Structure-of-arrays storage: the fields touched every update (position,
+// velocity, life) sit in their own arrays, the type byte is only read when
+// drawing. Live slots are tracked in a bitmask walked with count-trailing-
+// zeros, so update()/draw() cost scales with live particles rather than
+// CAPACITY, and spawn/free pop/push a free-slot stack in O(1).
+template <typename Scalar, uint16_t CAPACITY>
+class BasicParticleSystem {
 private:
-    struct Particle {
-        float x, y;
-        float vx, vy;
-        uint8_t type;
-        float life;
-        bool active;
-    };
-    
-    Particle particles[MAX_PARTICLES];
-    int activeCount;
-    
+    static constexpr uint16_t MASK_WORDS = (CAPACITY + 31) / 32;
+    static constexpr Scalar LIFE_STEP = toScalar<Scalar>(0.01f);
+
+    Scalar x[CAPACITY], y[CAPACITY];
+    Scalar vx[CAPACITY], vy[CAPACITY];
+    Scalar life[CAPACITY];
+    uint8_t type[CAPACITY];
+
+    uint32_t activeMask[MASK_WORDS];
+    uint16_t freeSlots[CAPACITY];
+    uint16_t freeCount;
+
+    void release(uint16_t slot) {
+        activeMask[slot >> 5] &= ~(1UL << (slot & 31));
+        freeSlots[freeCount++] = slot;
+    }
+
 public:
-    ParticleSystem() : activeCount(0) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            particles[i].active = false;
+    // Call fn(slot) for every live particle
+    template <typename Function>
+    void forEachActive(Function fn) const {
+        for (uint16_t word = 0; word < MASK_WORDS; word++) {
+            uint32_t bits = activeMask[word];
+            while (bits) {
+                uint16_t slot = (word << 5) + __builtin_ctz(bits);
+                bits &= bits - 1;
+                fn(slot);
+            }
         }
     }
+
+    BasicParticleSystem() {
+        clear();
+    }
     
-    void addParticle(float x, float y, float vx, float vy, uint8_t type = 0) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) {
-                particles[i] = {x, y, vx, vy, type, 1.0f, true};
-                activeCount++;
-                break;
-            }
-        }
+    // Returns the slot used, or -1 when the pool is full
+    int addParticle(Scalar px, Scalar py, Scalar pvx, Scalar pvy, uint8_t particleType = 0) {
+        if (freeCount == 0) return -1;
+        uint16_t slot = freeSlots[--freeCount];
+        x[slot] = px;
+        y[slot] = py;
+        vx[slot] = pvx;
+        vy[slot] = pvy;
+        life[slot] = Scalar(1);
+        type[slot] = particleType;
+        activeMask[slot >> 5] |= 1UL << (slot & 31);
+        return slot;
+    }
+    
+    // Custom motion instead of update(): fn(slot, x, y, vx, vy) moves a
+    // particle in place and returns false to free it. Life is left alone.
+    template <typename Function>
+    void step(Function fn) {
+        forEachActive([&](uint16_t i) {
+            if (!fn(i, x[i], y[i], vx[i], vy[i])) release(i);
+        });
     }
     
     void update() {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            
-            particles[i].x += particles[i].vx;
-            particles[i].y += particles[i].vy;
-            particles[i].life -= 0.01f;
+        const Scalar left = Scalar(X_OFFSET), right = Scalar(X_OFFSET + FRAME_WIDTH);
+        const Scalar top = Scalar(Y_OFFSET), bottom = Scalar(Y_OFFSET + FRAME_HEIGHT);
+
+        forEachActive([&](uint16_t i) {
+            x[i] += vx[i];
+            y[i] += vy[i];
+            life[i] -= LIFE_STEP;
             
             // Remove particles that are off-screen or dead
-            if (particles[i].life <= 0 || 
-                particles[i].x < X_OFFSET || particles[i].x > X_OFFSET + FRAME_WIDTH ||
-                particles[i].y < Y_OFFSET || particles[i].y > Y_OFFSET + FRAME_HEIGHT) {
-                particles[i].active = false;
-                activeCount--;
+            if (life[i] <= Scalar(0) || 
+                x[i] < left || x[i] > right ||
+                y[i] < top || y[i] > bottom) {
+                release(i);
             }
-        }
+        });
     }
     
+    // One batched pass straight into the frame buffer, clipped to the window
     void draw(U8G2 &display) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            
-            int x = (int)particles[i].x;
-            int y = (int)particles[i].y;
+        PixelKernels<Panel> pixels(display);
+        forEachActive([&](uint16_t i) {
+            int px = scalarToInt(x[i]);
+            int py = scalarToInt(y[i]);
             
-            switch (particles[i].type) {
+            switch (type[i]) {
                 case 0: // Snow
                     if (i % 4 == 0) {
-                        display.drawBox(x, y, 2, 2);
+                        pixels.setBlock2x2(px, py);
                     } else {
-                        display.drawPixel(x, y);
+                        pixels.setPixel(px, py);
                     }
                     break;
                 case 1: // Rain
-                    display.drawVLine(x, y, 2);
+                    pixels.setVSpan(px, py, 2);
                     break;
                 case 2: // Stars
-                    display.drawPixel(x, y);
+                    pixels.setPixel(px, py);
                     break;
             }
-        }
+        });
     }
     
     void clear() {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            particles[i].active = false;
+        memset(activeMask, 0, sizeof(activeMask));
+        // Hand out low slots first
+        for (uint16_t i = 0; i < CAPACITY; i++) {
+            freeSlots[i] = CAPACITY - 1 - i;
         }
-        activeCount = 0;
+        freeCount = CAPACITY;
     }
     
-    int getActiveCount() const { return activeCount; }
+    Scalar getX(uint16_t slot) const { return x[slot]; }
+    Scalar getY(uint16_t slot) const { return y[slot]; }
+    
+    int getActiveCount() const { return CAPACITY - freeCount; }
+    static constexpr uint16_t getCapacity() { return CAPACITY; }
 };
 
+typedef BasicParticleSystem<AnimationScalar, MAX_PARTICLES> ParticleSystem;
+
 #endif // ANIMATION_MANAGER_H 
\ No newline at end of file
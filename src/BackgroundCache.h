@@ -0,0 +1,130 @@
+#ifndef BACKGROUND_CACHE_H
+#define BACKGROUND_CACHE_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+
+// Cached static background layers
+//
+// A scene's static content is rendered once through the normal drawing code
+// and the window is captured from the U8g2 buffer. Each frame then starts
+// with a copy of the cached layer instead of clearBuffer() plus redrawing.
+// The layer covers whole pages (the 40 pixel window at y = 12 spans pages
+// 1-6 of the 128x64 buffer, all 5 pages of a native 72x40 one), so
+// restoring it is one memcpy per page with no bit shifting.
+template <typename PanelT, uint8_t SLOTS>
+class BackgroundCache {
+public:
+    typedef void (*RenderFunction)(uint8_t scene);
+
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int firstColumn = PanelT::X_OFFSET;
+    static constexpr int columns = PanelT::WINDOW_WIDTH;
+    static constexpr int firstPage = PanelT::FIRST_PAGE;
+    static constexpr int pages = PanelT::WINDOW_PAGES;
+
+    struct Slot {
+        int16_t scene;          // -1 when empty
+        unsigned long lastUsed;
+        uint8_t pixels[columns * pages];
+    };
+
+    U8G2 &display;
+    RenderFunction render;
+    Slot slots[SLOTS];
+    unsigned long useCounter;
+    unsigned long hits, misses, prefetches;
+
+    Slot *find(uint8_t scene) {
+        for (uint8_t i = 0; i < SLOTS; i++) {
+            if (slots[i].scene == scene) return &slots[i];
+        }
+        return nullptr;
+    }
+
+    // Least recently used slot, never the one holding keepScene (-1: any)
+    Slot *victim(int16_t keepScene) {
+        Slot *oldest = nullptr;
+        for (uint8_t i = 0; i < SLOTS; i++) {
+            if (keepScene >= 0 && slots[i].scene == keepScene) continue;
+            if (!oldest || slots[i].lastUsed < oldest->lastUsed) oldest = &slots[i];
+        }
+        return oldest;
+    }
+
+    // Render into the (cleared) display buffer and capture the window
+    void fill(Slot &slot, uint8_t scene) {
+        display.clearBuffer();
+        render(scene);
+
+        const uint8_t *buffer = display.getBufferPtr();
+        for (uint8_t p = 0; p < pages; p++) {
+            memcpy(slot.pixels + p * columns, buffer + (firstPage + p) * stride + firstColumn, columns);
+        }
+        slot.scene = scene;
+    }
+
+public:
+    BackgroundCache(U8G2 &u8g2, RenderFunction renderFunction)
+        : display(u8g2), render(renderFunction),
+          useCounter(0), hits(0), misses(0), prefetches(0) {
+        invalidate();
+    }
+
+    // Start a frame: the display buffer is cleared and holds the scene's
+    // background. Renders the layer first on a cache miss.
+    void restore(uint8_t scene) {
+        Slot *slot = find(scene);
+        if (!slot) {
+            misses++;
+            slot = victim(-1);
+            fill(*slot, scene);
+            slot->lastUsed = ++useCounter;
+            return;  // The buffer already holds the freshly rendered layer
+        }
+
+        hits++;
+        slot->lastUsed = ++useCounter;
+        display.clearBuffer();
+        uint8_t *buffer = display.getBufferPtr();
+        for (uint8_t p = 0; p < pages; p++) {
+            memcpy(buffer + (firstPage + p) * stride + firstColumn, slot->pixels + p * columns, columns);
+        }
+    }
+
+    // Render a scene's layer ahead of time. Uses the display buffer as
+    // scratch, so only call it after the frame has been sent. Never evicts
+    // currentScene. Returns true if anything was rendered.
+    bool prefetch(uint8_t scene, uint8_t currentScene) {
+        if (find(scene)) return false;
+        Slot *slot = victim(currentScene);
+        if (!slot) return false;
+        prefetches++;
+        fill(*slot, scene);
+        slot->lastUsed = ++useCounter;
+        return true;
+    }
+
+    bool isCached(uint8_t scene) { return find(scene) != nullptr; }
+
+    void invalidate() {
+        for (uint8_t i = 0; i < SLOTS; i++) {
+            slots[i].scene = -1;
+            slots[i].lastUsed = 0;
+        }
+    }
+
+    unsigned long getHits() const { return hits; }
+    unsigned long getMisses() const { return misses; }
+    unsigned long getPrefetches() const { return prefetches; }
+
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+        prefetches = 0;
+    }
+};
+
+#endif // BACKGROUND_CACHE_H
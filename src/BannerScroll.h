@@ -0,0 +1,172 @@
+#ifndef BANNER_SCROLL_H
+#define BANNER_SCROLL_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+
+// Scrolling banner on the controller's horizontal scroll
+//
+// The software ticker redraws the text every frame and moves it a pixel
+// every 100 ms, so the tiles under it go out on most frames. In hardware
+// mode the banner gets the bottom page of the window to itself: once the
+// ticker has brought the whole text into view, that frame's page is cleared
+// to just the text, written into the controller's RAM row and left to the
+// SSD1306 to scroll (0x27, one pixel every HARDWARE_SCROLL_FRAMES panel
+// refreshes). From then on the text is not drawn and the page is held out
+// of the tile transfer. A frame without the banner (the flyover scene)
+// stops the scroll and the page is sent again.
+//
+// The SSD1306 scrolls whole RAM rows, its 0x26/0x27 command has no column
+// limits (the last two bytes are fixed at 00/FF), so the strip covers all
+// 128 columns and is blank outside the window; the glass only shows the
+// window's 72. Panels without the command (SH1106) keep the software
+// ticker. The datasheet asks for no RAM access while scrolling; only the
+// other pages are written then, modules that object should leave the mode
+// off.
+//
+// Render side, in loop(): beginFrame(), keepAlive() from the ticker's
+// update, clearStrip() when the ticker hands over, and endFrame() for the
+// frame's command. Transfer side: start()/stop() with the frame that
+// carried the command, from whichever task sends frames.
+template <typename PanelT>
+class BannerScroll {
+public:
+    enum Command : uint8_t { NONE, START, STOP };
+
+    static constexpr bool SUPPORTED = PanelT::HORIZONTAL_SCROLL;
+
+    // Bottom page wholly inside the window, and a 4x6 font baseline that
+    // keeps ascent and descent in it
+    static constexpr int PAGE = (PanelT::Y_OFFSET + PanelT::WINDOW_HEIGHT) / 8 - 1;
+    static constexpr int BASELINE = PAGE * 8 + 6;
+
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int CONTROLLER_COLUMNS = 128;
+    static constexpr int stripColumn = PanelT::CONTROLLER_COLUMN + PanelT::X_OFFSET;
+    static constexpr uint8_t CMD_SCROLL_LEFT = 0x27;
+    static constexpr uint8_t CMD_SCROLL_OFF = 0x2E;
+    static constexpr uint8_t CMD_SCROLL_ON = 0x2F;
+
+    static_assert(PAGE * 8 >= PanelT::Y_OFFSET, "Banner page must lie inside the window");
+    static_assert(!SUPPORTED || stripColumn + PanelT::WINDOW_WIDTH <= CONTROLLER_COLUMNS,
+                  "Window must fit the controller row");
+
+    // Scroll step interval encoding of 0x26/0x27
+    static constexpr uint8_t intervalCode(uint16_t frames) {
+        switch (frames) {
+            case 5: return 0;
+            case 64: return 1;
+            case 128: return 2;
+            case 256: return 3;
+            case 3: return 4;
+            case 4: return 5;
+            case 25: return 6;
+            case 2: return 7;
+            default: return 0xFF;
+        }
+    }
+    static_assert(intervalCode(HARDWARE_SCROLL_FRAMES) != 0xFF, "HARDWARE_SCROLL_FRAMES not supported");
+
+    bool enabled;
+    bool scrolling;     // Render side: started and not stopped since
+    bool wanted;        // A banner object ran this frame
+    bool handover;      // The strip was rendered this frame
+    bool restarting;    // New text, stop and hand over again
+    bool onPanel;       // Transfer side: the controller is scrolling
+    unsigned long starts;
+    uint8_t strip[CONTROLLER_COLUMNS];
+
+public:
+    BannerScroll()
+        : enabled(false), scrolling(false), wanted(false), handover(false), restarting(false),
+          onPanel(false), starts(0) {
+        memset(strip, 0, sizeof(strip));
+    }
+
+    // Ignored on panels without the command, the ticker stays in software
+    void setEnabled(bool on) { enabled = on && SUPPORTED; }
+    bool isEnabled() const { return enabled; }
+
+    // The panel moves the text, don't draw it
+    bool isScrolling() const { return scrolling; }
+
+    // The page-aligned baseline applies in software too, so the handover
+    // doesn't move the text
+    int baseline() const {
+        return enabled ? BASELINE : PanelT::Y_OFFSET + PanelT::WINDOW_HEIGHT - 2;
+    }
+
+    void beginFrame() { wanted = handover = false; }
+    void keepAlive() { wanted = true; }
+
+    // The banner changed: stop scrolling the old strip, the software ticker
+    // hands over again once the new text is in view
+    void restart() { restarting = scrolling; }
+
+    // Text at x, width pixels wide, clear of the window border
+    bool canStart(int x, int width) const {
+        return enabled && !scrolling && x > PanelT::X_OFFSET &&
+               x + width < PanelT::X_OFFSET + PanelT::WINDOW_WIDTH - 1;
+    }
+
+    // Blank the banner page of the window, the text is drawn next and the
+    // page goes to the panel as the strip
+    void clearStrip(U8G2 &display) {
+        memset(display.getBufferPtr() + PAGE * stride + PanelT::X_OFFSET, 0, PanelT::WINDOW_WIDTH);
+        handover = true;
+    }
+
+    // Command to send with the frame just rendered
+    Command endFrame() {
+        if (handover) {
+            scrolling = true;
+            starts++;
+            return START;
+        }
+        if (scrolling && (restarting || !(enabled && wanted))) {
+            scrolling = restarting = false;
+            return STOP;
+        }
+        return NONE;
+    }
+
+    // Write the frame's banner page as the controller row and scroll it
+    void start(u8x8_t *u8x8, const uint8_t *frame) {
+        memset(strip, 0, sizeof(strip));
+        memcpy(strip + stripColumn, frame + PAGE * stride + PanelT::X_OFFSET, PanelT::WINDOW_WIDTH);
+
+        u8x8_cad_StartTransfer(u8x8);
+        u8x8_cad_SendCmd(u8x8, CMD_SCROLL_OFF);  // Setup and RAM writes need it stopped
+        u8x8_cad_SendCmd(u8x8, 0x10);
+        u8x8_cad_SendCmd(u8x8, 0x00);
+        u8x8_cad_SendCmd(u8x8, 0xb0 | PAGE);
+        u8x8_cad_SendData(u8x8, CONTROLLER_COLUMNS, strip);
+        u8x8_cad_SendCmd(u8x8, CMD_SCROLL_LEFT);
+        u8x8_cad_SendArg(u8x8, 0x00);
+        u8x8_cad_SendArg(u8x8, PAGE);
+        u8x8_cad_SendArg(u8x8, intervalCode(HARDWARE_SCROLL_FRAMES));
+        u8x8_cad_SendArg(u8x8, PAGE);
+        u8x8_cad_SendArg(u8x8, 0x00);
+        u8x8_cad_SendArg(u8x8, 0xFF);
+        u8x8_cad_SendCmd(u8x8, CMD_SCROLL_ON);
+        u8x8_cad_EndTransfer(u8x8);
+        onPanel = true;
+    }
+
+    // Stop scrolling, the page's RAM has to be written again after this
+    void stop(u8x8_t *u8x8) {
+        u8x8_cad_StartTransfer(u8x8);
+        u8x8_cad_SendCmd(u8x8, CMD_SCROLL_OFF);
+        u8x8_cad_EndTransfer(u8x8);
+        onPanel = false;
+    }
+
+    bool isOnPanel() const { return onPanel; }
+
+    unsigned long getStarts() const { return starts; }
+    void resetStats() { starts = 0; }
+};
+
+#endif // BANNER_SCROLL_H
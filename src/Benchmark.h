@@ -0,0 +1,64 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <Arduino.h>
+
+// Micro benchmarks that run the same way on the device ("bench" over
+// serial) and on the host (--bench). Results are printed to out (anything
+// with printf) one per line as "BENCH <name> <ns/item> <cycles/item>";
+// cycles are 0 on the host. An item is one call unless the case sets
+// itemsPerCall (e.g. particles per update).
+class Benchmark {
+public:
+    typedef void (*Function)();
+
+    struct Case {
+        const char *name;
+        Function function;
+        uint32_t iterations;
+        uint32_t itemsPerCall = 1;
+    };
+
+    static uint64_t nowNs() {
+        #ifdef ESP32
+        return (uint64_t)micros() * 1000;
+        #else
+        return HostClock::nowNs();
+        #endif
+    }
+
+    static uint32_t cycles() {
+        #ifdef ESP32
+        return ESP.getCycleCount();
+        #else
+        return 0;
+        #endif
+    }
+
+    template <typename Output>
+    static void run(Output &out, const Case &benchCase) {
+        benchCase.function();  // Warm up caches and lazy state
+
+        uint32_t startCycles = cycles();
+        uint64_t startNs = nowNs();
+        for (uint32_t i = 0; i < benchCase.iterations; i++) {
+            benchCase.function();
+        }
+        uint64_t elapsedNs = nowNs() - startNs;
+        uint32_t elapsedCycles = cycles() - startCycles;
+
+        double items = (double)benchCase.iterations * benchCase.itemsPerCall;
+        out.printf("BENCH %s %.1f %.1f\n", benchCase.name,
+                   elapsedNs / items, elapsedCycles / items);
+    }
+
+    template <typename Output>
+    static void runAll(Output &out, const Case *cases, size_t count, const char *filter = nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            if (filter && !strstr(cases[i].name, filter)) continue;
+            run(out, cases[i]);
+        }
+    }
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,231 @@
+#ifndef CLIP_PLAYER_H
+#define CLIP_PLAYER_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// Pre-recorded animation clips
+//
+// A clip is a sequence of 72x40 1bpp window frames kept in flash, encoded
+// by tools/clip_encode.cpp from PBM images. Frames are in window-relative
+// page layout (72 columns x 5 pages, byte = 8 vertical pixels, LSB on top),
+// so a decoded frame is the window as U8g2 would hold it on a native 72x40
+// panel.
+//
+// Clip layout:
+//   'C' 'L' width height frameCount(u16 LE) frameMs(u16 LE)
+//   then per frame: flags (bit 0 = keyframe) and runs covering the frame
+// Runs:
+//   0nnnnnnn          n+1 literal bytes follow
+//   10nnnnnn          n+1 zero bytes
+//   11nnnnnn value    n+3 copies of value
+// A keyframe's runs are the frame itself. Any other frame is XORed onto
+// the previous one, so a zero run is a skip and unchanged frames cost a
+// handful of bytes. Frame 0 is always a keyframe.
+struct Clip {
+    const uint8_t *data;
+    uint32_t size;
+};
+
+class ClipFormat {
+public:
+    static constexpr uint8_t WIDTH = 72;
+    static constexpr uint8_t HEIGHT = 40;
+    static constexpr uint8_t PAGES = HEIGHT / 8;
+    static constexpr size_t FRAME_BYTES = WIDTH * PAGES;
+    static constexpr size_t HEADER_BYTES = 8;
+    static constexpr uint8_t KEYFRAME = 0x01;
+
+    static constexpr uint8_t LITERAL_MAX = 128;
+    static constexpr uint8_t ZERO_RUN = 0x80;
+    static constexpr uint8_t ZERO_RUN_MAX = 64;
+    static constexpr uint8_t REPEAT_RUN = 0xC0;
+    static constexpr uint8_t REPEAT_RUN_MIN = 3;
+    static constexpr uint8_t REPEAT_RUN_MAX = 66;
+
+    // Worst case record: flags byte plus all literals
+    static constexpr size_t MAX_RECORD_BYTES = 1 + FRAME_BYTES + (FRAME_BYTES + LITERAL_MAX - 1) / LITERAL_MAX;
+
+    static bool isValid(const Clip &clip) {
+        return clip.size >= HEADER_BYTES && clip.data[0] == 'C' && clip.data[1] == 'L' &&
+               clip.data[2] == WIDTH && clip.data[3] == HEIGHT && getFrameCount(clip) > 0;
+    }
+
+    static uint16_t getFrameCount(const Clip &clip) { return clip.data[4] | clip.data[5] << 8; }
+    static uint16_t getFrameMs(const Clip &clip) { return clip.data[6] | clip.data[7] << 8; }
+    static const uint8_t *firstFrame(const Clip &clip) { return clip.data + HEADER_BYTES; }
+
+    // Decode one frame record into frame (FRAME_BYTES, holding the previous
+    // frame for deltas), returns the start of the next record
+    static const uint8_t *decodeFrame(const uint8_t *data, uint8_t *frame) {
+        const bool key = *data++ & KEYFRAME;
+        uint8_t *out = frame;
+        uint8_t *const end = frame + FRAME_BYTES;
+
+        while (out < end) {
+            const uint8_t control = *data++;
+            size_t count;
+            if (control < ZERO_RUN) {
+                count = min((size_t)control + 1, (size_t)(end - out));
+                if (key) {
+                    memcpy(out, data, count);
+                } else {
+                    for (size_t i = 0; i < count; i++) out[i] ^= data[i];
+                }
+                data += control + 1;
+            } else if (control < REPEAT_RUN) {
+                count = min((size_t)(control & 0x3F) + 1, (size_t)(end - out));
+                if (key) memset(out, 0, count);
+            } else {
+                count = min((size_t)(control & 0x3F) + REPEAT_RUN_MIN, (size_t)(end - out));
+                const uint8_t value = *data++;
+                if (key) {
+                    memset(out, value, count);
+                } else {
+                    for (size_t i = 0; i < count; i++) out[i] ^= value;
+                }
+            }
+            out += count;
+        }
+        return data;
+    }
+
+    // Encode one frame record into out (MAX_RECORD_BYTES), as a keyframe
+    // when previous is null, else as the XOR delta against it. Returns the
+    // record length.
+    static size_t encodeFrame(const uint8_t *frame, const uint8_t *previous, uint8_t *out) {
+        auto at = [&](size_t i) -> uint8_t { return previous ? frame[i] ^ previous[i] : frame[i]; };
+        size_t length = 0;
+        out[length++] = previous ? 0 : KEYFRAME;
+
+        size_t i = 0, literalStart = 0;
+        auto flushLiterals = [&](size_t end) {
+            while (literalStart < end) {
+                size_t count = min(end - literalStart, (size_t)LITERAL_MAX);
+                out[length++] = count - 1;
+                for (size_t j = 0; j < count; j++) out[length++] = at(literalStart + j);
+                literalStart += count;
+            }
+        };
+
+        while (i < FRAME_BYTES) {
+            const uint8_t value = at(i);
+            size_t run = 1;
+            while (i + run < FRAME_BYTES && at(i + run) == value) run++;
+
+            if (value == 0) {
+                // A single zero between literals is cheaper as a literal
+                if (run == 1 && literalStart < i && i + 1 < FRAME_BYTES) {
+                    i++;
+                    continue;
+                }
+                flushLiterals(i);
+                run = min(run, (size_t)ZERO_RUN_MAX);
+                out[length++] = ZERO_RUN | (run - 1);
+            } else if (run >= REPEAT_RUN_MIN) {
+                flushLiterals(i);
+                run = min(run, (size_t)REPEAT_RUN_MAX);
+                out[length++] = REPEAT_RUN | (run - REPEAT_RUN_MIN);
+                out[length++] = value;
+            } else {
+                i += run;
+                continue;
+            }
+            i += run;
+            literalStart = i;
+        }
+        flushLiterals(FRAME_BYTES);
+        return length;
+    }
+};
+
+// Plays a clip into the animation window of the panel's U8g2 buffer. The
+// previous frame is kept decoded (360 bytes) because deltas build on it
+// and the render buffer is rebuilt from the background every frame; the
+// blit into the buffer ORs it over whatever is there, one pass per page
+// with the window's bit shift fixed at compile time.
+template <typename PanelT>
+class ClipPlayer {
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int shift = PanelT::Y_OFFSET & 7;
+    static_assert(PanelT::WINDOW_WIDTH == ClipFormat::WIDTH &&
+                  PanelT::WINDOW_HEIGHT == ClipFormat::HEIGHT, "Clips are window sized");
+
+    const Clip &clip;
+    bool valid;
+    bool looping;
+    bool started;
+    uint16_t frameCount, frameMs;
+    uint16_t decodedFrames;         // Frames decoded since the last keyframe restart
+    const uint8_t *next;
+    unsigned long startMs;
+    uint8_t frame[ClipFormat::FRAME_BYTES];
+
+    void restart() {
+        next = ClipFormat::firstFrame(clip);
+        decodedFrames = 0;
+    }
+
+public:
+    ClipPlayer(const Clip &source, bool loop)
+        : clip(source), valid(ClipFormat::isValid(source)), looping(loop), started(false),
+          frameCount(valid ? ClipFormat::getFrameCount(source) : 0),
+          frameMs(valid ? max((uint16_t)1, ClipFormat::getFrameMs(source)) : 1),
+          decodedFrames(0), next(nullptr), startMs(0) {
+        memset(frame, 0, sizeof(frame));
+    }
+
+    // Start from frame 0 on the next update()
+    void rewind() { started = false; }
+
+    // Decode up to the frame due at now. Late calls decode the frames in
+    // between, deltas cannot be skipped.
+    void update(unsigned long now) {
+        if (!valid) return;
+        if (!started) {
+            startMs = now;
+            started = true;
+            restart();
+        }
+
+        uint32_t due = (now - startMs) / frameMs;
+        if (due >= frameCount) due = looping ? due % frameCount : frameCount - 1;
+        if (due + 1 < decodedFrames) restart();  // Looped back to the start
+
+        while (decodedFrames <= due) {
+            next = ClipFormat::decodeFrame(next, frame);
+            decodedFrames++;
+        }
+    }
+
+    // When the frame after the one due at now starts
+    unsigned long getNextFrameMs(unsigned long now) const {
+        if (!started) return now;
+        return startMs + ((now - startMs) / frameMs + 1) * frameMs;
+    }
+
+    void draw(U8G2 &display) {
+        if (!valid || !started) return;
+        uint8_t *window = display.getBufferPtr() + PanelT::byteOffset(PanelT::X_OFFSET, PanelT::Y_OFFSET);
+        for (int p = 0; p < ClipFormat::PAGES; p++) {
+            const uint8_t *src = frame + p * ClipFormat::WIDTH;
+            uint8_t *dst = window + p * stride;
+            for (int c = 0; c < ClipFormat::WIDTH; c++) {
+                if constexpr (shift == 0) {
+                    dst[c] |= src[c];
+                } else {
+                    dst[c] |= src[c] << shift;
+                    dst[c + stride] |= src[c] >> (8 - shift);
+                }
+            }
+        }
+    }
+
+    bool isValid() const { return valid; }
+    uint16_t getFrameCount() const { return frameCount; }
+    uint16_t getFrameIndex() const { return decodedFrames ? decodedFrames - 1 : 0; }
+    const uint8_t *getFrame() const { return frame; }
+};
+
+#endif // CLIP_PLAYER_H
@@ -3,17 +3,8 @@
 
 #include <Arduino.h>
 #include "config.h"
-
-// Debug levels
-enum DebugLevel {
-    DEBUG_ERROR = 0,
-    DEBUG_WARN = 1,
-    DEBUG_INFO = 2,
-    DEBUG_VERBOSE = 3
-};
-
-// Forward declare the debug print function
-void debugPrint(DebugLevel level, const char* format, ...);
+#include "ZoneProfiler.h"
+#include "Logging.h"
 
 // Memory monitoring
 class MemoryMonitor {
@@ -22,9 +13,9 @@ public:
         if (!ENABLE_SERIAL_DEBUG) return;
         
         #ifdef ESP32
-        Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
-        Serial.printf("Min free heap: %d bytes\n", ESP.getMinFreeHeap());
-        Serial.printf("Heap size: %d bytes\n", ESP.getHeapSize());
+        LOG_INFO("Free heap: %lu bytes\n", (unsigned long)ESP.getFreeHeap());
+        LOG_INFO("Min free heap: %lu bytes\n", (unsigned long)ESP.getMinFreeHeap());
+        LOG_INFO("Heap size: %lu bytes\n", (unsigned long)ESP.getHeapSize());
         #endif
     }
     
@@ -34,7 +25,7 @@ public:
         uint32_t currentFreeHeap = ESP.getFreeHeap();
         
         if (currentFreeHeap < lastFreeHeap - 1000) { // 1KB threshold
-            debugPrint(DEBUG_WARN, "Potential memory leak detected!");
+            LOG_WARN("Potential memory leak detected!\n");
             lastFreeHeap = currentFreeHeap;
             return true;
         }
@@ -44,56 +35,59 @@ public:
     }
 };
 
-// Performance monitoring
+// Performance monitoring: whole-frame times in a single-zone histogram,
+// see ZoneProfiler for per-zone timing
 class PerformanceMonitor {
 private:
-    unsigned long frameStartTime;
-    unsigned long maxFrameTime;
-    unsigned long frameCount;
-    float averageFrameTime;
+    typedef ZoneProfiler<1, 1> FrameHistogram;
+    
+    FrameHistogram histogram;
+    uint32_t frameStartTime;
+    bool inFrame;
     
 public:
-    PerformanceMonitor() : frameStartTime(0), maxFrameTime(0), frameCount(0), averageFrameTime(0) {}
+    PerformanceMonitor() : histogram(nullptr), frameStartTime(0), inFrame(false) {}
     
     void startFrame() {
-        frameStartTime = micros();
+        frameStartTime = FrameHistogram::nowUs();
+        inFrame = true;
     }
     
     void endFrame() {
-        if (frameStartTime == 0) return;
-        
-        unsigned long frameTime = micros() - frameStartTime;
-        frameCount++;
-        
-        // Update max
-        if (frameTime > maxFrameTime) {
-            maxFrameTime = frameTime;
-        }
+        if (!inFrame) return;
         
-        // Update average (rolling average)
-        averageFrameTime = (averageFrameTime * (frameCount - 1) + frameTime) / frameCount;
+        uint32_t frameTime = FrameHistogram::nowUs() - frameStartTime;
+        histogram.record(0, frameTime);
         
         // Report if frame time is excessive
         if (frameTime > 100000) { // > 100ms
-            debugPrint(DEBUG_WARN, "Slow frame detected: %lu us", frameTime);
+            LOG_WARN("Slow frame detected: %lu us\n", (unsigned long)frameTime);
         }
         
-        frameStartTime = 0;
+        inFrame = false;
     }
     
     void printStats() {
         if (!ENABLE_SERIAL_DEBUG) return;
         
-        Serial.printf("Performance Stats:\n");
-        Serial.printf("  Average frame time: %.2f us (%.1f FPS)\n", 
-                     averageFrameTime, 1000000.0f / averageFrameTime);
-        Serial.printf("  Max frame time: %lu us\n", maxFrameTime);
-        Serial.printf("  Total frames: %lu\n", frameCount);
+        const FrameHistogram::Histogram &frames = histogram.get(0, 0);
+        LOG_INFO("Performance Stats:\n");
+        LOG_INFO("  Average frame time: %lu us (%.1f FPS)\n",
+                     (unsigned long)FrameHistogram::mean(frames), getAverageFPS());
+        LOG_INFO("  p50/p95/p99 frame time: %lu/%lu/%lu us\n",
+                     (unsigned long)FrameHistogram::percentile(frames, 50),
+                     (unsigned long)FrameHistogram::percentile(frames, 95),
+                     (unsigned long)FrameHistogram::percentile(frames, 99));
+        LOG_INFO("  Max frame time: %lu us\n", (unsigned long)frames.maxUs);
+        LOG_INFO("  Total frames: %lu\n", (unsigned long)frames.samples);
     }
     
     float getAverageFPS() const {
-        return averageFrameTime > 0 ? 1000000.0f / averageFrameTime : 0;
+        uint32_t average = FrameHistogram::mean(histogram.get(0, 0));
+        return average > 0 ? 1000000.0f / average : 0;
     }
+    
+    void reset() { histogram.reset(); }
 };
 
 // Error handling
@@ -116,7 +110,7 @@ public:
         lastErrorTime = millis();
         
         if (ENABLE_SERIAL_DEBUG) {
-            Serial.printf("ERROR %d: %s\n", code, message ? message : "Unknown error");
+            LOG_ERROR("%d: %s\n", code, message ? message : "Unknown error");
         }
         
         // Flash LED or display error indicator if needed
@@ -136,26 +130,6 @@ private:
     }
 };
 
-// Debug printing with levels - implementation
-inline void debugPrint(DebugLevel level, const char* format, ...) {
-    if (!ENABLE_SERIAL_DEBUG) return;
-    
-    // Simple level filtering (could be made configurable)
-    #ifdef DEBUG_LEVEL
-    if (level > DEBUG_LEVEL) return;
-    #endif
-    
-    const char* levelStr[] = {"ERROR", "WARN", "INFO", "VERBOSE"};
-    
-    char buffer[256];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
-    
-    Serial.printf("[%s] %s\n", levelStr[level], buffer);
-}
-
 // Initialize static members
 uint8_t ErrorHandler::errorCount = 0;
 unsigned long ErrorHandler::lastErrorTime = 0;
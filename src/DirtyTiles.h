@@ -0,0 +1,117 @@
+#ifndef DIRTY_TILES_H
+#define DIRTY_TILES_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+
+// Dirty-tile display transfer
+//
+// Keeps a shadow copy of the tiles covering the animation window as they were
+// last sent, compares the freshly rendered buffer against it 8x8 tile by tile
+// and pushes only the changed runs of each page with u8x8_DrawTile(), the
+// call updateDisplayArea() uses underneath. Tiles outside the window are
+// never sent, the panel cannot show them anyway. The window and buffer
+// geometry come from the panel descriptor (see Panel.h). What the runs cost
+// on the bus depends on the I2C framing and is measured there
+// (I2cTransport.h). A page can be held back while the controller owns its
+// RAM (the banner's hardware scroll, BannerScroll.h).
+template <typename PanelT>
+class DirtyTileTransfer {
+private:
+    static constexpr int firstTileX = PanelT::FIRST_TILE_X;
+    static constexpr int firstTileY = PanelT::FIRST_PAGE;
+    static constexpr int tilesWide = PanelT::WINDOW_TILES_WIDE;
+    static constexpr int tilesHigh = PanelT::WINDOW_PAGES;
+    static constexpr int bufferTileWidth = PanelT::BUFFER_TILE_WIDTH;
+
+    U8G2 &display;
+    uint8_t shadow[tilesWide * tilesHigh * 8];
+    bool valid;
+    int8_t heldRow;     // Window tile row not sent, -1 for none
+
+    uint16_t lastFrameTiles;
+    unsigned long frameCount;
+    unsigned long totalTiles;
+
+    bool tileChanged(const uint8_t *src, uint8_t *dst) const {
+        for (int i = 0; i < 8; i++) {
+            if (src[i] != dst[i]) return true;
+        }
+        return false;
+    }
+
+public:
+    explicit DirtyTileTransfer(U8G2 &u8g2)
+        : display(u8g2), valid(false), heldRow(-1), lastFrameTiles(0), frameCount(0), totalTiles(0) {}
+
+    // Force the next send() to transfer the whole window
+    void invalidate() { valid = false; }
+
+    // Leave a buffer page out of send() until releasePage()
+    void holdPage(int page) {
+        heldRow = page >= firstTileY && page < firstTileY + tilesHigh ? page - firstTileY : -1;
+    }
+
+    // Send the held page again, whatever the panel shows there is stale
+    void releasePage() {
+        if (heldRow >= 0) valid = false;
+        heldRow = -1;
+    }
+
+    // Send the changed tiles of the display buffer, returns the number of
+    // tiles sent
+    uint16_t send() {
+        return send(display.getBufferPtr());
+    }
+
+    // Same for a copy of the display buffer (same size and layout), used
+    // when frames are sent from their own buffer while the next one renders
+    uint16_t send(const uint8_t *buffer) {
+        lastFrameTiles = 0;
+
+        for (int ty = 0; ty < tilesHigh; ty++) {
+            if (ty == heldRow) continue;
+            const uint8_t *row = buffer + ((firstTileY + ty) * bufferTileWidth + firstTileX) * 8;
+            uint8_t *shadowRow = shadow + ty * tilesWide * 8;
+            int runStart = -1;
+
+            for (int tx = 0; tx <= tilesWide; tx++) {
+                bool changed = false;
+                if (tx < tilesWide) {
+                    changed = !valid || tileChanged(row + tx * 8, shadowRow + tx * 8);
+                    if (changed) memcpy(shadowRow + tx * 8, row + tx * 8, 8);
+                }
+
+                if (changed && runStart < 0) {
+                    runStart = tx;
+                } else if (!changed && runStart >= 0) {
+                    int runLength = tx - runStart;
+                    u8x8_DrawTile(display.getU8x8(), firstTileX + runStart, firstTileY + ty,
+                                  runLength, (uint8_t *)row + runStart * 8);
+                    lastFrameTiles += runLength;
+                    runStart = -1;
+                }
+            }
+        }
+
+        valid = true;
+        frameCount++;
+        totalTiles += lastFrameTiles;
+        return lastFrameTiles;
+    }
+
+    uint16_t getLastFrameTiles() const { return lastFrameTiles; }
+    static constexpr uint16_t getWindowTiles() { return tilesWide * tilesHigh; }
+
+    float getAverageFrameTiles() const {
+        return frameCount > 0 ? (float)totalTiles / frameCount : 0;
+    }
+
+    void resetStats() {
+        frameCount = 0;
+        totalTiles = 0;
+    }
+};
+
+#endif // DIRTY_TILES_H
@@ -0,0 +1,91 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+// Fixed-point arithmetic
+//
+// The ESP32-C3 is a RISC-V core without an FPU, so every float add or
+// multiply is a soft-float library call. Fixed<FRAC_BITS> keeps values as
+// scaled integers: add/subtract are plain integer ops, multiply is one wide
+// multiply and a shift. Conversions from float are constexpr so constants
+// are folded at compile time.
+template <int FRAC_BITS, typename Storage, typename Wide>
+class Fixed {
+private:
+    Storage raw;
+
+    struct RawTag {};
+    constexpr Fixed(Storage value, RawTag) : raw(value) {}
+
+public:
+    static constexpr int FRACTION_BITS = FRAC_BITS;
+    static constexpr Storage ONE = (Storage)1 << FRAC_BITS;
+
+    constexpr Fixed() : raw(0) {}
+    constexpr Fixed(int value) : raw((Storage)(value * ONE)) {}
+    constexpr Fixed(float value)
+        : raw((Storage)(value >= 0 ? value * ONE + 0.5f : value * ONE - 0.5f)) {}
+    constexpr Fixed(double value)
+        : raw((Storage)(value >= 0 ? value * ONE + 0.5 : value * ONE - 0.5)) {}
+
+    static constexpr Fixed fromRaw(Storage value) { return Fixed(value, RawTag()); }
+    constexpr Storage getRaw() const { return raw; }
+
+    // Rounds towards negative infinity, like a pixel coordinate should
+    constexpr int toInt() const { return raw >> FRAC_BITS; }
+    constexpr float toFloat() const { return (float)raw / ONE; }
+
+    constexpr Fixed operator+(Fixed other) const { return fromRaw(raw + other.raw); }
+    constexpr Fixed operator-(Fixed other) const { return fromRaw(raw - other.raw); }
+    constexpr Fixed operator-() const { return fromRaw(-raw); }
+    constexpr Fixed operator*(Fixed other) const {
+        return fromRaw((Storage)(((Wide)raw * other.raw) >> FRAC_BITS));
+    }
+    constexpr Fixed operator/(Fixed other) const {
+        // Scaled by multiplying, a left shift of a negative value is undefined
+        return fromRaw((Storage)((Wide)raw * ONE / other.raw));
+    }
+    constexpr Fixed operator*(int factor) const { return fromRaw(raw * factor); }
+
+    Fixed &operator+=(Fixed other) { raw += other.raw; return *this; }
+    Fixed &operator-=(Fixed other) { raw -= other.raw; return *this; }
+    Fixed &operator*=(Fixed other) { *this = *this * other; return *this; }
+
+    constexpr bool operator<(Fixed other) const { return raw < other.raw; }
+    constexpr bool operator>(Fixed other) const { return raw > other.raw; }
+    constexpr bool operator<=(Fixed other) const { return raw <= other.raw; }
+    constexpr bool operator>=(Fixed other) const { return raw >= other.raw; }
+    constexpr bool operator==(Fixed other) const { return raw == other.raw; }
+    constexpr bool operator!=(Fixed other) const { return raw != other.raw; }
+};
+
+typedef Fixed<8, int16_t, int32_t> Q8_8;      // +-127, 1/256 steps
+typedef Fixed<16, int32_t, int64_t> Q16_16;   // +-32767, 1/65536 steps
+
+// Helpers so animation code can be written once for float and Fixed
+template <typename Scalar>
+constexpr Scalar toScalar(float value) { return Scalar(value); }
+
+// Floors like Fixed::toInt(), so both backends put a particle at -0.5 on -1
+constexpr int scalarToInt(float value) {
+    const int truncated = (int)value;
+    return value < truncated ? truncated - 1 : truncated;
+}
+
+template <int F, typename S, typename W>
+constexpr int scalarToInt(Fixed<F, S, W> value) { return value.toInt(); }
+
+constexpr float scalarAbs(float value) { return value < 0 ? -value : value; }
+
+template <int F, typename S, typename W>
+constexpr Fixed<F, S, W> scalarAbs(Fixed<F, S, W> value) {
+    return value.getRaw() < 0 ? -value : value;
+}
+
+constexpr float scalarToFloat(float value) { return value; }
+
+template <int F, typename S, typename W>
+constexpr float scalarToFloat(Fixed<F, S, W> value) { return value.toFloat(); }
+
+#endif // FIXED_POINT_H
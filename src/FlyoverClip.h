@@ -0,0 +1,264 @@
+#ifndef FLYOVER_CLIP_H
+#define FLYOVER_CLIP_H
+
+#include "ClipPlayer.h"
+
+// Generated by tools/clip_encode.cpp from 80 frames, do not edit
+inline constexpr uint8_t CLIP_FLYOVER_DATA[] PROGMEM = {
+    0x43, 0x4c, 0x48, 0x28, 0x50, 0x00, 0x32, 0x00, 0x01, 0x87, 0x00, 0x10, 0x93, 0x03, 0x08, 0x08,
+    0x00, 0x10, 0x88, 0x02, 0x40, 0xa0, 0x40, 0x86, 0x04, 0x08, 0x00, 0x40, 0xf0, 0x48, 0x9b, 0x01,
+    0x80, 0x20, 0x81, 0x02, 0x02, 0x00, 0x08, 0xbc, 0x00, 0x04, 0xa9, 0x00, 0x40, 0x96, 0xc0, 0x80,
+    0xc2, 0xc0, 0x00, 0x80, 0xc0, 0xf8, 0x85, 0xc0, 0x80, 0xc2, 0xc0, 0xc0, 0x80, 0x86, 0xc0, 0x80,
+    0xc2, 0xc0, 0x00, 0x80, 0xc0, 0xf8, 0x85, 0xc0, 0x80, 0xc2, 0xc0, 0xc0, 0x80, 0x83, 0xc0, 0x7f,
+    0x01, 0x67, 0x67, 0xc4, 0x7f, 0x01, 0x67, 0x67, 0xc0, 0x7f, 0x00, 0x7e, 0xc0, 0x7f, 0x01, 0x67,
+    0x67, 0xc4, 0x7f, 0x01, 0x67, 0x67, 0xc0, 0x7f, 0x00, 0x7e, 0xc0, 0x7f, 0x01, 0x67, 0x67, 0xc4,
+    0x7f, 0x01, 0x67, 0x67, 0xc0, 0x7f, 0x00, 0x7e, 0xc0, 0x7f, 0x01, 0x67, 0x67, 0xc4, 0x7f, 0x03,
+    0x67, 0x67, 0x7f, 0x7f, 0x80, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x10, 0xbf, 0xa0, 0x00, 0x10,
+    0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xb6, 0x00, 0x10, 0x9d, 0x00, 0x20, 0x83, 0x00, 0x08, 0xbf, 0xbf,
+    0xbf, 0xbf, 0x8b, 0x00, 0xbf, 0x88, 0x00, 0x08, 0x8b, 0x00, 0x20, 0x81, 0x02, 0x02, 0x00, 0x08,
+    0xbf, 0xbf, 0xbf, 0xbf, 0x8b, 0x00, 0x9b, 0x01, 0x08, 0x14, 0x8b, 0x02, 0x40, 0xa0, 0x40, 0x88,
+    0x02, 0x40, 0xa0, 0x40, 0x8f, 0x01, 0x38, 0x08, 0x89, 0x00, 0x80, 0x82, 0x00, 0x02, 0xb6, 0x00,
+    0x01, 0xbf, 0xbf, 0xbf, 0x95, 0x00, 0x87, 0x00, 0x10, 0xbf, 0x80, 0x02, 0x74, 0x98, 0x04, 0x87,
+    0x00, 0x80, 0xba, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x95, 0x00, 0x87, 0x00, 0x10, 0xae, 0x00, 0x08,
+    0x8f, 0x04, 0x50, 0x9c, 0xe0, 0x34, 0x08, 0xbf, 0x83, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x94, 0x00,
+    0x9c, 0x00, 0x08, 0x99, 0x00, 0x08, 0x91, 0x04, 0x18, 0xd0, 0x70, 0x30, 0x08, 0xbf, 0x83, 0x00,
+    0x01, 0xbf, 0xbf, 0xbf, 0x92, 0x00, 0x9b, 0x01, 0x08, 0x1c, 0x95, 0x00, 0x08, 0x93, 0x00, 0x20,
+    0x81, 0x04, 0x80, 0x18, 0xc8, 0x38, 0x08, 0x86, 0x02, 0x02, 0x05, 0x02, 0xb5, 0x03, 0x01, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x01, 0xab, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9f, 0x00, 0x10, 0x92,
+    0x00, 0x08, 0x93, 0x09, 0x60, 0xc0, 0x00, 0x58, 0x78, 0xe0, 0x28, 0x36, 0x4c, 0x02, 0xbd, 0x00,
+    0x01, 0x84, 0x00, 0x01, 0xab, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9f, 0x00, 0x10, 0x95, 0x00,
+    0x40, 0x90, 0x0a, 0x04, 0x00, 0x40, 0x18, 0x00, 0x60, 0x00, 0x46, 0x52, 0x0e, 0x02, 0xbf, 0x84,
+    0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x40, 0x90, 0x05, 0x18,
+    0x18, 0x04, 0x00, 0x38, 0x58, 0x81, 0x04, 0x06, 0x74, 0x1c, 0x0c, 0x02, 0xbf, 0x82, 0x00, 0x14,
+    0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xa9, 0x02, 0x40, 0xe0, 0x40, 0x88, 0x02, 0x40, 0xb0, 0x40, 0x8f,
+    0x03, 0x24, 0x06, 0x48, 0x02, 0x81, 0x0b, 0xb8, 0x08, 0x28, 0x48, 0x2e, 0x70, 0x1a, 0x04, 0x00,
+    0x02, 0x05, 0x02, 0xbd, 0x00, 0x10, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xb6, 0x00, 0x10, 0x91, 0x0e,
+    0x26, 0x74, 0x1c, 0x4c, 0x02, 0x80, 0x50, 0x90, 0x40, 0x00, 0x4c, 0x28, 0x58, 0x98, 0x04, 0x81,
+    0x00, 0x08, 0xbf, 0xbf, 0xbf, 0xbf, 0x8b, 0x00, 0xbf, 0x88, 0x0f, 0x14, 0x24, 0x14, 0x02, 0x63,
+    0x34, 0x31, 0x30, 0xb0, 0x60, 0x28, 0x48, 0x28, 0x04, 0x86, 0x08, 0x81, 0x00, 0x08, 0xbf, 0xbf,
+    0xbf, 0xbf, 0x8b, 0x00, 0xbf, 0x88, 0x12, 0x1c, 0x2c, 0x14, 0x44, 0x17, 0x6e, 0x0f, 0x0c, 0x02,
+    0x00, 0x08, 0x68, 0x94, 0x44, 0x12, 0x30, 0x0d, 0x06, 0x01, 0xbf, 0xbf, 0xbf, 0xbf, 0x8b, 0x00,
+    0x87, 0x00, 0x10, 0x92, 0x01, 0x08, 0x14, 0x8b, 0x02, 0x40, 0xa0, 0x40, 0x88, 0x02, 0x40, 0xa0,
+    0x40, 0x91, 0x07, 0x48, 0x40, 0x00, 0x60, 0x06, 0x22, 0x4e, 0x02, 0x81, 0x00, 0xbc, 0x81, 0x04,
+    0x30, 0x01, 0x19, 0x27, 0x01, 0xbf, 0xbf, 0xbf, 0xbf, 0x8a, 0x00, 0x87, 0x00, 0x10, 0xae, 0x00,
+    0x08, 0x8f, 0x15, 0x60, 0x00, 0x40, 0x28, 0x48, 0x20, 0x00, 0x26, 0x44, 0x2c, 0x4c, 0x02, 0x20,
+    0x0c, 0x3c, 0x10, 0x00, 0x13, 0x22, 0x1e, 0x26, 0x01, 0xb1, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x95,
+    0x00, 0x9c, 0x00, 0x08, 0x99, 0x00, 0x08, 0x8f, 0x01, 0xb0, 0x60, 0x81, 0x12, 0x40, 0x28, 0x14,
+    0x24, 0x14, 0x02, 0x53, 0x04, 0x01, 0x00, 0x20, 0x0c, 0x14, 0x74, 0x14, 0x67, 0x38, 0x0d, 0x02,
+    0xb1, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x94, 0x00, 0x8c, 0x02, 0x80, 0x00, 0x80, 0x8c, 0x00, 0x08,
+    0x95, 0x00, 0x08, 0x93, 0x18, 0x7c, 0xd0, 0xf0, 0xa8, 0x18, 0x18, 0x04, 0x34, 0x0a, 0x22, 0x09,
+    0x08, 0x16, 0x1b, 0x18, 0x18, 0x10, 0x70, 0x14, 0x44, 0x12, 0x30, 0x0d, 0x06, 0x01, 0xae, 0x01,
+    0x01, 0x01, 0xb0, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x8c, 0xc1, 0x80, 0x8a, 0x01, 0x08, 0x14,
+    0x81, 0x00, 0x10, 0x92, 0x00, 0x08, 0x93, 0x04, 0x02, 0x1c, 0x40, 0x58, 0xb0, 0x82, 0x11, 0x1e,
+    0x10, 0x00, 0x18, 0x01, 0x04, 0x13, 0x02, 0x05, 0x02, 0x24, 0x20, 0x00, 0x30, 0x03, 0x19, 0x27,
+    0x01, 0xbf, 0xa0, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x8d, 0x02, 0x80, 0x00, 0x80, 0x88, 0x02,
+    0x80, 0x00, 0x80, 0x82, 0x00, 0x10, 0x95, 0x00, 0x40, 0x90, 0x1a, 0x02, 0x02, 0x1e, 0x5c, 0x18,
+    0xe8, 0xb0, 0x00, 0x10, 0x06, 0x2e, 0x1a, 0x0a, 0x03, 0x17, 0x15, 0x20, 0x01, 0x20, 0x14, 0x14,
+    0x02, 0x0a, 0x19, 0x20, 0x0e, 0x13, 0xb4, 0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0x99, 0xc1,
+    0x80, 0x8c, 0x00, 0x40, 0x8a, 0x00, 0x40, 0x90, 0x07, 0x0c, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x58,
+    0xb0, 0x81, 0x11, 0x20, 0x14, 0x00, 0x10, 0x00, 0x21, 0x20, 0x05, 0x01, 0x00, 0x10, 0x06, 0x00,
+    0x18, 0x00, 0x11, 0x14, 0x03, 0xb3, 0x00, 0x14, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0x9a, 0x00, 0x80,
+    0x82, 0x00, 0x80, 0x8a, 0x00, 0x40, 0x8a, 0x00, 0x10, 0x90, 0x09, 0x48, 0x1c, 0x0e, 0x02, 0x02,
+    0x1e, 0x5c, 0x18, 0xe8, 0xb0, 0x81, 0x01, 0x04, 0x14, 0x82, 0x06, 0x30, 0x06, 0x06, 0x01, 0x00,
+    0x0e, 0x16, 0x81, 0x03, 0x01, 0x1d, 0x07, 0x03, 0xb1, 0x00, 0x10, 0xbf, 0xbf, 0xbf, 0x8d, 0x00,
+    0x93, 0x02, 0x80, 0x00, 0x80, 0x85, 0x02, 0x80, 0x00, 0x80, 0x89, 0x02, 0x40, 0xa0, 0x40, 0x88,
+    0x02, 0x40, 0xb0, 0x40, 0x8f, 0x0a, 0x58, 0x58, 0x10, 0x0c, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x58,
+    0xb0, 0x81, 0x07, 0x20, 0x14, 0x30, 0x09, 0x38, 0x09, 0x01, 0x12, 0x82, 0x07, 0x2e, 0x02, 0x0a,
+    0x12, 0x0b, 0x1c, 0x26, 0x01, 0xbf, 0xbf, 0xbf, 0xbe, 0x00, 0x93, 0xc1, 0x80, 0xb0, 0x15, 0x20,
+    0x58, 0x58, 0x10, 0x0c, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x58, 0xb0, 0x00, 0x20, 0x10, 0x16, 0x08,
+    0x00, 0x08, 0x09, 0x14, 0x13, 0x81, 0x02, 0x20, 0x34, 0x10, 0x81, 0x03, 0x13, 0x39, 0x27, 0x01,
+    0xbf, 0xbf, 0xbf, 0xbd, 0x00, 0x94, 0x04, 0x80, 0x00, 0x40, 0x80, 0x40, 0x86, 0x02, 0x80, 0x00,
+    0x80, 0xa4, 0x21, 0x80, 0xa0, 0xb8, 0xf0, 0xcc, 0xec, 0xe6, 0xe0, 0xe3, 0xff, 0xbe, 0xe8, 0xf8,
+    0x54, 0x0c, 0x1c, 0x08, 0x02, 0x05, 0x09, 0x0c, 0x14, 0x0b, 0x0d, 0x0c, 0x2c, 0x18, 0x08, 0x0a,
+    0x12, 0x19, 0x38, 0x06, 0x03, 0xbf, 0xbf, 0xbf, 0xbc, 0x00, 0x87, 0x00, 0x10, 0x8d, 0x03, 0xc0,
+    0x00, 0x40, 0x80, 0x82, 0x00, 0x08, 0x81, 0x03, 0x80, 0xc0, 0x00, 0x40, 0xa5, 0x0c, 0x40, 0x10,
+    0x2c, 0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0xa0, 0x0c, 0x58, 0x82, 0x06, 0x07, 0x09, 0x1d,
+    0x09, 0x1d, 0x02, 0x03, 0x82, 0x06, 0x02, 0x1d, 0x09, 0x1d, 0x08, 0x00, 0x01, 0xbf, 0xbf, 0xbf,
+    0xbb, 0x00, 0x87, 0x00, 0x10, 0x8e, 0x00, 0x80, 0x82, 0x02, 0x88, 0x14, 0x08, 0x82, 0x00, 0xc0,
+    0xc0, 0x80, 0x00, 0x40, 0x82, 0x02, 0x40, 0xa0, 0x40, 0x88, 0x02, 0x40, 0xa0, 0x48, 0x90, 0x0f,
+    0x10, 0x00, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x0e, 0x0c, 0x74, 0x58,
+    0x81, 0x07, 0x02, 0x0a, 0x08, 0x18, 0x01, 0x01, 0x0b, 0x13, 0x81, 0x07, 0x07, 0x03, 0x04, 0x0c,
+    0x00, 0x02, 0x07, 0x09, 0xbf, 0xbf, 0xbf, 0xb9, 0x00, 0x99, 0xc0, 0x80, 0x00, 0x88, 0x85, 0x03,
+    0xc0, 0x40, 0xc0, 0x40, 0x8f, 0x00, 0x08, 0x90, 0x00, 0x10, 0x82, 0x0c, 0x40, 0x10, 0x2c, 0x2c,
+    0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x81, 0x02, 0x10, 0x1a, 0x08, 0x81, 0x02,
+    0x09, 0x18, 0x13, 0x81, 0x02, 0x08, 0x0b, 0x04, 0x81, 0x02, 0x04, 0x0e, 0x09, 0xbf, 0xbf, 0xbf,
+    0xb8, 0x00, 0x9a, 0x04, 0x80, 0x00, 0x48, 0x80, 0x40, 0x84, 0x04, 0xc0, 0x80, 0xc0, 0x00, 0x80,
+    0x89, 0x00, 0x08, 0x99, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2c,
+    0x0c, 0x74, 0x58, 0x00, 0x10, 0x0a, 0x02, 0x05, 0x09, 0x0c, 0x18, 0x07, 0x01, 0x00, 0x08, 0x03,
+    0x07, 0x05, 0x1d, 0x01, 0x17, 0x07, 0x03, 0xbf, 0x92, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9c,
+    0x03, 0xc0, 0x40, 0xc0, 0x50, 0x85, 0xc1, 0x80, 0x88, 0x00, 0x08, 0x98, 0x00, 0x20, 0x81, 0x0c,
+    0x40, 0x10, 0x2c, 0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x82, 0x00, 0x07,
+    0xc1, 0x0c, 0x01, 0x06, 0x01, 0x82, 0x00, 0x02, 0xc0, 0x18, 0x02, 0x19, 0x04, 0x03, 0xbf, 0x91,
+    0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9b, 0x06, 0x08, 0x14, 0xc0, 0x80, 0x90, 0x80, 0x40, 0x84,
+    0x00, 0x80, 0x82, 0x00, 0x80, 0x89, 0x00, 0x40, 0x90, 0x00, 0x10, 0x82, 0x01, 0x10, 0x20, 0x82,
+    0x0d, 0x40, 0x50, 0x3c, 0x00, 0x04, 0x0e, 0x05, 0x00, 0x01, 0x07, 0x2e, 0x0c, 0x74, 0x58, 0x81,
+    0x07, 0x07, 0x03, 0x04, 0x0c, 0x00, 0x06, 0x03, 0x09, 0x81, 0x07, 0x02, 0x0a, 0x08, 0x18, 0x01,
+    0x05, 0x0f, 0x13, 0xa4, 0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0x9f, 0x03, 0xc0, 0x00, 0x40,
+    0x80, 0x85, 0x03, 0x80, 0x80, 0x00, 0x40, 0x88, 0x00, 0x40, 0x90, 0x04, 0x10, 0x00, 0x30, 0x00,
+    0x10, 0x85, 0x0c, 0x40, 0x10, 0x0c, 0x2c, 0x08, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58,
+    0x81, 0x07, 0x08, 0x13, 0x0d, 0x05, 0x05, 0x01, 0x02, 0x13, 0x81, 0x07, 0x10, 0x02, 0x01, 0x05,
+    0x05, 0x0c, 0x14, 0x09, 0xa3, 0x00, 0x14, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xa0, 0x00, 0x80, 0x82,
+    0x00, 0x80, 0x84, 0xc1, 0x80, 0x00, 0x40, 0x86, 0x00, 0x10, 0x92, 0x00, 0x30, 0x82, 0x00, 0x10,
+    0x81, 0x00, 0x80, 0x81, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x20, 0x0c, 0x07, 0x01, 0x01, 0x0f, 0x2e,
+    0x0c, 0x74, 0x58, 0x00, 0x10, 0x0a, 0x02, 0x00, 0x18, 0x09, 0x09, 0x03, 0x03, 0x00, 0x08, 0x03,
+    0x07, 0x00, 0x0c, 0x04, 0x06, 0x03, 0x01, 0xa1, 0x00, 0x10, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xa2,
+    0xc1, 0x80, 0x85, 0x03, 0xc0, 0x40, 0xc0, 0x40, 0x85, 0x00, 0x10, 0x92, 0x00, 0x80, 0x81, 0x01,
+    0x20, 0x10, 0x81, 0x00, 0x80, 0x82, 0x0d, 0x20, 0x40, 0x10, 0x28, 0x2c, 0x08, 0x06, 0x01, 0x00,
+    0x01, 0x0e, 0x20, 0x2c, 0x58, 0x82, 0x00, 0x02, 0xc0, 0x18, 0x02, 0x19, 0x00, 0x03, 0x82, 0x00,
+    0x07, 0xc1, 0x0c, 0x01, 0x02, 0x01, 0xbf, 0xbf, 0xbf, 0xaf, 0x00, 0xa3, 0x0e, 0x80, 0x00, 0x40,
+    0x80, 0x40, 0x00, 0x40, 0xa0, 0x40, 0x00, 0xc0, 0x80, 0xc0, 0x00, 0x80, 0x82, 0x02, 0x40, 0xa0,
+    0x40, 0x91, 0x05, 0x80, 0x00, 0x20, 0x20, 0x00, 0x10, 0x81, 0x00, 0x20, 0x81, 0x0f, 0x20, 0x00,
+    0x42, 0x57, 0x3e, 0x08, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58, 0x81, 0x07,
+    0x02, 0x12, 0x01, 0x1d, 0x04, 0x04, 0x03, 0x09, 0x81, 0x07, 0x07, 0x1b, 0x0d, 0x09, 0x05, 0x07,
+    0x0f, 0x13, 0xbf, 0xbf, 0xbf, 0xad, 0x00, 0xa5, 0x03, 0xc0, 0x40, 0xc0, 0x40, 0x85, 0xc1, 0x80,
+    0x97, 0x04, 0x20, 0x20, 0x10, 0x00, 0x10, 0x83, 0x00, 0xc0, 0x82, 0x0d, 0x02, 0x40, 0x10, 0x2c,
+    0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x81, 0x02, 0x08, 0x0b, 0x04, 0x81,
+    0x02, 0x04, 0x0a, 0x09, 0x81, 0x02, 0x10, 0x1a, 0x08, 0x81, 0x02, 0x09, 0x1c, 0x13, 0xbf, 0xbf,
+    0xbf, 0xac, 0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x87, 0x00, 0xc0, 0xc0, 0x80, 0x85, 0x00,
+    0x80, 0x82, 0x00, 0x80, 0x93, 0x04, 0x40, 0x00, 0x20, 0x00, 0x10, 0x82, 0x04, 0x10, 0x20, 0x00,
+    0xc0, 0xc0, 0x83, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c,
+    0x74, 0x58, 0x00, 0x08, 0x03, 0x07, 0x00, 0x0c, 0x04, 0x02, 0x07, 0x01, 0x00, 0x10, 0x0a, 0x02,
+    0x00, 0x18, 0x09, 0x0d, 0x07, 0x03, 0xbf, 0xbf, 0xbf, 0xaa, 0x00, 0x87, 0x00, 0x10, 0x94, 0x00,
+    0x08, 0x89, 0x00, 0xc0, 0x81, 0x00, 0x80, 0x85, 0x01, 0x80, 0xc0, 0x82, 0x00, 0x08, 0x90, 0x00,
+    0x40, 0x86, 0x00, 0x10, 0x82, 0x01, 0xc0, 0x40, 0x81, 0x00, 0x80, 0x81, 0x0c, 0x40, 0x10, 0x2c,
+    0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x82, 0x06, 0x07, 0x09, 0x1d, 0x09,
+    0x1d, 0x02, 0x03, 0x82, 0x06, 0x02, 0x1d, 0x09, 0x1d, 0x08, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0xa9,
+    0x00, 0x9b, 0x01, 0x08, 0x1c, 0x8b, 0x04, 0xc0, 0xa0, 0x40, 0x00, 0x80, 0x84, 0x04, 0xc0, 0x80,
+    0x80, 0x20, 0x08, 0x91, 0x00, 0x80, 0x83, 0x00, 0x40, 0x85, 0x14, 0x40, 0x40, 0x00, 0x80, 0x00,
+    0x10, 0x00, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58,
+    0x81, 0x07, 0x02, 0x0a, 0x08, 0x18, 0x01, 0x01, 0x0b, 0x13, 0x81, 0x07, 0x07, 0x03, 0x04, 0x0c,
+    0x00, 0x02, 0x07, 0x09, 0xbf, 0xbf, 0xbf, 0xa7, 0x00, 0x9c, 0x00, 0x08, 0x8d, 0xc1, 0x80, 0x83,
+    0x05, 0x08, 0x00, 0xc0, 0x00, 0xc0, 0x40, 0x90, 0x00, 0x80, 0x81, 0x02, 0x40, 0x20, 0x40, 0x84,
+    0x06, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x82, 0x0c, 0x40, 0x10, 0x2c, 0x2c, 0x08, 0x06,
+    0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x81, 0x02, 0x10, 0x1a, 0x08, 0x81, 0x02, 0x09, 0x18,
+    0x13, 0x81, 0x02, 0x08, 0x0b, 0x04, 0x81, 0x02, 0x04, 0x0e, 0x09, 0xbf, 0x82, 0x00, 0x40, 0xbf,
+    0xbf, 0xa2, 0x00, 0x9f, 0x00, 0x10, 0x8b, 0x04, 0x80, 0x00, 0x40, 0x80, 0x40, 0x81, 0x00, 0x08,
+    0x81, 0x04, 0x80, 0x80, 0xc0, 0x00, 0x80, 0x91, 0x01, 0x40, 0x20, 0x85, 0x00, 0x40, 0x81, 0x01,
+    0x60, 0x10, 0x82, 0x00, 0x08, 0x81, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01,
+    0x0f, 0x2e, 0x0c, 0x74, 0x58, 0x00, 0x10, 0x0a, 0x02, 0x05, 0x09, 0x0c, 0x18, 0x07, 0x01, 0x00,
+    0x08, 0x03, 0x07, 0x05, 0x1d, 0x01, 0x17, 0x07, 0x03, 0xbf, 0x80, 0x00, 0x40, 0xbf, 0xbf, 0xa2,
+    0x00, 0x9f, 0x00, 0x10, 0x8d, 0x03, 0xc0, 0x40, 0xc0, 0x40, 0x83, 0x01, 0x40, 0x00, 0xc1, 0x80,
+    0x99, 0x02, 0x20, 0x00, 0x60, 0x82, 0x01, 0x08, 0x08, 0x83, 0x0c, 0x40, 0x10, 0x2c, 0x2c, 0x08,
+    0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x82, 0x00, 0x07, 0xc1, 0x0c, 0x01, 0x06, 0x01,
+    0x82, 0x00, 0x02, 0xc0, 0x18, 0x02, 0x19, 0x04, 0x03, 0x94, 0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x8d,
+    0x00, 0x9b, 0x01, 0x08, 0x14, 0x8c, 0x00, 0x40, 0x83, 0x00, 0xc0, 0xc0, 0x80, 0x00, 0x40, 0x81,
+    0x00, 0x40, 0x81, 0x00, 0x80, 0x82, 0x00, 0x80, 0x97, 0x03, 0x30, 0x02, 0x0d, 0x02, 0x81, 0x02,
+    0x08, 0x00, 0x20, 0x83, 0x0d, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e,
+    0x0c, 0x74, 0x58, 0x81, 0x07, 0x07, 0x03, 0x04, 0x0c, 0x00, 0x06, 0x03, 0x09, 0x81, 0x07, 0x02,
+    0x0a, 0x08, 0x18, 0x01, 0x05, 0x0f, 0x13, 0x92, 0x00, 0x14, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xaa,
+    0x00, 0x40, 0x85, 0x05, 0xc0, 0x00, 0x40, 0x80, 0x00, 0x10, 0x83, 0x03, 0x80, 0xc0, 0x00, 0x40,
+    0x96, 0x02, 0x10, 0x00, 0x08, 0x81, 0x05, 0x08, 0x00, 0x40, 0x20, 0x00, 0x08, 0x83, 0x0c, 0x40,
+    0x10, 0x2c, 0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x81, 0x07, 0x08, 0x13,
+    0x0d, 0x05, 0x05, 0x01, 0x02, 0x13, 0x81, 0x07, 0x10, 0x02, 0x01, 0x05, 0x05, 0x0c, 0x14, 0x09,
+    0x91, 0x00, 0x10, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xb2, 0x00, 0x80, 0x82, 0x00, 0x90, 0x84, 0x00,
+    0xc0, 0xc0, 0x80, 0x00, 0x40, 0x93, 0x00, 0x20, 0x83, 0xc0, 0x08, 0x03, 0x40, 0x00, 0x10, 0x08,
+    0x84, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58,
+    0x00, 0x10, 0x0a, 0x02, 0x00, 0x18, 0x09, 0x09, 0x03, 0x03, 0x00, 0x08, 0x03, 0x07, 0x00, 0x0c,
+    0x04, 0x06, 0x03, 0x01, 0xbf, 0xbf, 0xbf, 0x9e, 0x00, 0xb4, 0xc1, 0x80, 0x85, 0x03, 0xc0, 0x40,
+    0xc0, 0x40, 0x92, 0x07, 0x20, 0x10, 0x00, 0x02, 0x20, 0x08, 0x00, 0x08, 0x81, 0x00, 0x50, 0x84,
+    0x00, 0x40, 0x81, 0x0c, 0x40, 0x10, 0x2c, 0x2c, 0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c,
+    0x58, 0x82, 0x00, 0x02, 0xc0, 0x18, 0x02, 0x19, 0x00, 0x03, 0x82, 0x00, 0x07, 0xc1, 0x0c, 0x01,
+    0x02, 0x01, 0xbf, 0xbf, 0xbf, 0x9d, 0x00, 0xa9, 0x02, 0x40, 0xa0, 0x40, 0x88, 0x04, 0xc0, 0xa0,
+    0x40, 0x80, 0x40, 0x84, 0x04, 0xc0, 0x80, 0xc0, 0x00, 0x80, 0x8f, 0x05, 0x80, 0x00, 0x10, 0x12,
+    0x07, 0x22, 0x84, 0x02, 0x40, 0x20, 0x08, 0x81, 0x01, 0x20, 0x40, 0x82, 0x0d, 0x40, 0x50, 0x3c,
+    0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58, 0x81, 0x07, 0x02, 0x12, 0x01,
+    0x1d, 0x04, 0x04, 0x03, 0x09, 0x81, 0x07, 0x07, 0x1b, 0x0d, 0x09, 0x05, 0x07, 0x0f, 0x13, 0xbf,
+    0xbf, 0xbf, 0x9b, 0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x98, 0x03, 0x80, 0x40, 0xc0, 0x40,
+    0x85, 0xc1, 0x80, 0x8e, 0x00, 0x80, 0x81, 0x00, 0x10, 0x81, 0x00, 0x80, 0x81, 0x00, 0x08, 0x81,
+    0x01, 0x20, 0x08, 0x81, 0x02, 0xa0, 0x00, 0x10, 0x83, 0x0c, 0x40, 0x10, 0x2c, 0x2c, 0x08, 0x06,
+    0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x81, 0x02, 0x08, 0x0b, 0x04, 0x81, 0x02, 0x04, 0x0a,
+    0x09, 0x81, 0x02, 0x10, 0x1a, 0x08, 0x81, 0x02, 0x09, 0x1c, 0x13, 0xbf, 0xbf, 0xbf, 0x9a, 0x00,
+    0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x98, 0x01, 0x08, 0xc0, 0xc0, 0x80, 0x00, 0x40, 0x84, 0x00,
+    0x80, 0x93, 0x00, 0x08, 0x81, 0x04, 0x80, 0x80, 0x00, 0x08, 0x08, 0x84, 0x02, 0xa0, 0x00, 0x10,
+    0x84, 0x21, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58,
+    0x00, 0x08, 0x03, 0x07, 0x00, 0x0c, 0x04, 0x02, 0x07, 0x01, 0x00, 0x10, 0x0a, 0x02, 0x00, 0x18,
+    0x09, 0x0d, 0x07, 0x03, 0xbf, 0xbf, 0xbf, 0x98, 0x00, 0x9c, 0x00, 0x08, 0x99, 0x00, 0x08, 0x81,
+    0x03, 0xc0, 0x00, 0x40, 0x80, 0x85, 0x01, 0x80, 0xc0, 0x90, 0x07, 0x08, 0x00, 0x10, 0x00, 0x80,
+    0x00, 0x08, 0x08, 0x84, 0x01, 0x20, 0x40, 0x82, 0x00, 0x40, 0x83, 0x0c, 0x40, 0x10, 0x2c, 0x2c,
+    0x08, 0x06, 0x01, 0x00, 0x01, 0x0e, 0x20, 0x2c, 0x58, 0x82, 0x06, 0x07, 0x09, 0x1d, 0x09, 0x1d,
+    0x02, 0x03, 0x82, 0x04, 0x02, 0x1d, 0x09, 0x1d, 0x08, 0xbf, 0xbf, 0xbf, 0x99, 0x00, 0x9b, 0x01,
+    0x08, 0x1c, 0x8b, 0x02, 0x40, 0xa0, 0x40, 0x86, 0x04, 0x08, 0x00, 0x40, 0xa0, 0x40, 0x82, 0x00,
+    0x80, 0x82, 0x00, 0x80, 0x84, 0x00, 0xc0, 0x92, 0x01, 0x10, 0x20, 0x81, 0x00, 0x08, 0x86, 0x05,
+    0x40, 0x80, 0x00, 0x20, 0x40, 0x40, 0x83, 0x0d, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07, 0x01,
+    0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58, 0x81, 0x07, 0x02, 0x0a, 0x08, 0x18, 0x01, 0x01, 0x0b, 0x13,
+    0x81, 0x03, 0x07, 0x03, 0x04, 0x0c, 0xb5, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9f, 0x00, 0x10,
+    0x92, 0x00, 0x08, 0x88, 0xc1, 0x80, 0x98, 0x00, 0x20, 0x86, 0x09, 0x40, 0x00, 0x40, 0x00, 0x80,
+    0x40, 0x20, 0x00, 0x40, 0x08, 0x84, 0x0c, 0x40, 0x10, 0x2c, 0x2c, 0x08, 0x06, 0x01, 0x00, 0x01,
+    0x0e, 0x20, 0x2c, 0x58, 0x81, 0x02, 0x10, 0x1a, 0x08, 0x81, 0x02, 0x09, 0x18, 0x13, 0x81, 0x02,
+    0x08, 0x0b, 0x04, 0xb5, 0x00, 0x40, 0xbf, 0xbf, 0xa2, 0x00, 0x9f, 0x00, 0x10, 0x95, 0x00, 0x40,
+    0x86, 0x04, 0x80, 0x00, 0x40, 0x80, 0x40, 0x9c, 0x07, 0x80, 0x00, 0x60, 0x00, 0x40, 0x00, 0x08,
+    0x40, 0x81, 0x03, 0x10, 0x08, 0x00, 0x10, 0x83, 0x1b, 0x40, 0x50, 0x3c, 0x00, 0x24, 0x0e, 0x07,
+    0x01, 0x01, 0x0f, 0x2e, 0x0c, 0x74, 0x58, 0x00, 0x10, 0x0a, 0x02, 0x05, 0x09, 0x0c, 0x18, 0x07,
+    0x01, 0x00, 0x08, 0x03, 0x07, 0x89, 0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0xaa, 0x00, 0x40,
+    0x8a, 0x00, 0x40, 0x88, 0x03, 0xc0, 0x00, 0x40, 0x80, 0x9b, 0x02, 0x80, 0x00, 0x20, 0x82, 0x00,
+    0x08, 0x82, 0x03, 0x10, 0x08, 0x00, 0x10, 0x82, 0x00, 0x08, 0x81, 0x0c, 0x40, 0xd0, 0xdc, 0xa8,
+    0xf8, 0xee, 0xe3, 0xe1, 0xe0, 0xec, 0xd0, 0xbc, 0xbc, 0xc0, 0x0c, 0x06, 0x0b, 0x09, 0x1d, 0x09,
+    0x1d, 0x02, 0x0f, 0xc0, 0x0c, 0x89, 0x00, 0x14, 0xbf, 0xbf, 0xbf, 0x8d, 0x00, 0x9b, 0x01, 0x08,
+    0x14, 0x8c, 0x00, 0x40, 0x8a, 0x00, 0x10, 0x89, 0x00, 0x80, 0x82, 0x00, 0x80, 0x90, 0x02, 0x02,
+    0x05, 0x02, 0x88, 0x00, 0x20, 0x86, 0x02, 0x08, 0x00, 0x10, 0x81, 0x12, 0x10, 0x08, 0x00, 0x08,
+    0x00, 0x80, 0xa0, 0x78, 0x00, 0x48, 0x1c, 0x0e, 0x02, 0x02, 0x1e, 0x5c, 0x18, 0xe8, 0xb0, 0x81,
+    0x07, 0x0e, 0x06, 0x08, 0x18, 0x01, 0x0d, 0x07, 0x13, 0x8a, 0x00, 0x10, 0xbf, 0xbf, 0xbf, 0x8d,
+    0x00, 0xb6, 0x00, 0x10, 0x8b, 0x02, 0x80, 0x00, 0x80, 0x8e, 0x00, 0x20, 0x83, 0x00, 0x08, 0x87,
+    0x00, 0x20, 0x83, 0x00, 0xa0, 0x82, 0x04, 0x40, 0x10, 0x10, 0x00, 0x10, 0x81, 0x00, 0x08, 0x82,
+    0x0c, 0x80, 0x20, 0x58, 0x58, 0x10, 0x0c, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x58, 0xb0, 0x81, 0x07,
+    0x10, 0x26, 0x1a, 0x0a, 0x0a, 0x03, 0x04, 0x26, 0xbf, 0xbf, 0xbf, 0x98, 0x00, 0xbf, 0x95, 0x00,
+    0x20, 0x81, 0x02, 0x02, 0x00, 0x08, 0x8c, 0x00, 0xa0, 0x82, 0x04, 0x40, 0x00, 0x10, 0x08, 0x10,
+    0x82, 0x00, 0x10, 0x82, 0x15, 0x80, 0xa0, 0x78, 0x00, 0x48, 0x1c, 0x0e, 0x02, 0x02, 0x1e, 0x5c,
+    0x18, 0xe8, 0xb0, 0x00, 0x20, 0x14, 0x04, 0x00, 0x30, 0x13, 0x12, 0xbf, 0xbf, 0xbf, 0x98, 0x00,
+    0xbf, 0x94, 0x00, 0x80, 0x82, 0x00, 0x02, 0x89, 0x00, 0x20, 0x85, 0x00, 0x80, 0x83, 0x02, 0x28,
+    0x10, 0x10, 0x81, 0x00, 0x10, 0x81, 0x00, 0x80, 0x81, 0x0c, 0x80, 0x20, 0x58, 0x58, 0x10, 0x0c,
+    0x02, 0x00, 0x02, 0x1c, 0x40, 0x58, 0xb0, 0x82, 0x00, 0x04, 0xc0, 0x30, 0xbf, 0xbf, 0xbf, 0x98,
+    0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x8a, 0x02, 0x40, 0xa0, 0x40, 0x88, 0x02, 0x40, 0xa0,
+    0x40, 0x9b, 0x00, 0x80, 0x81, 0x02, 0x02, 0x05, 0x02, 0x88, 0x00, 0x20, 0x85, 0x00, 0x80, 0x83,
+    0x02, 0x28, 0x00, 0x90, 0x84, 0x00, 0x80, 0x82, 0x0d, 0x80, 0xa0, 0x78, 0x00, 0x48, 0x1c, 0x0e,
+    0x02, 0x02, 0x1e, 0x5c, 0x18, 0xe8, 0xb0, 0x81, 0x02, 0x04, 0x24, 0x02, 0xbf, 0xbf, 0xbf, 0x98,
+    0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x98, 0x00, 0x08, 0xb6, 0x02, 0x08, 0x00, 0x80, 0x8a,
+    0x0c, 0x80, 0x20, 0x58, 0x58, 0x10, 0x0c, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x58, 0xb0, 0x81, 0x01,
+    0x10, 0x16, 0xbf, 0xbf, 0xbf, 0x98, 0x00, 0x9c, 0x00, 0x08, 0x99, 0x00, 0x08, 0xb4, 0x00, 0x80,
+    0x84, 0x00, 0x10, 0x87, 0x11, 0x40, 0x00, 0x80, 0xa0, 0xf8, 0xe0, 0x40, 0xfc, 0xde, 0xc6, 0xc0,
+    0xdc, 0x98, 0xf8, 0xc8, 0x78, 0x18, 0x08, 0xb9, 0xc9, 0x01, 0xbf, 0xbf, 0x92, 0x00, 0x9c, 0x00,
+    0x08, 0x95, 0x00, 0x08, 0xb8, 0x00, 0x80, 0x84, 0x00, 0x10, 0x87, 0x00, 0x40, 0x83, 0x0b, 0x40,
+    0xb0, 0xb0, 0x20, 0x18, 0x04, 0x00, 0x04, 0x38, 0x80, 0xb0, 0x60, 0xb5, 0x01, 0x40, 0x01, 0x82,
+    0x00, 0x01, 0x8a, 0x00, 0x01, 0xbf, 0xbf, 0x91, 0x00, 0x9b, 0x01, 0x08, 0x14, 0x81, 0x00, 0x10,
+    0x88, 0x02, 0x40, 0xa0, 0x40, 0x86, 0x04, 0x08, 0x00, 0x40, 0xa0, 0x40, 0xb4, 0x00, 0x10, 0x93,
+    0x0b, 0x40, 0xf0, 0x00, 0x90, 0x38, 0x1c, 0x04, 0x04, 0x3c, 0xb8, 0x30, 0xd0, 0xb4, 0x03, 0x40,
+    0x01, 0x00, 0x02, 0x81, 0x01, 0x01, 0x01, 0x89, 0x00, 0x01, 0xbf, 0xbf, 0x90, 0x00, 0x9f, 0x00,
+    0x10, 0x95, 0x00, 0x40, 0xb5, 0x00, 0x10, 0x88, 0x00, 0x80, 0x83, 0x00, 0x40, 0x86, 0x09, 0x40,
+    0xb0, 0xb0, 0x20, 0x18, 0x04, 0x00, 0x04, 0x38, 0x80, 0x89, 0x00, 0x04, 0xac, 0x00, 0x02, 0x83,
+    0x00, 0x01, 0xbf, 0xbf, 0x9a, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x40, 0xbe, 0x01, 0x40, 0x80,
+    0x83, 0x00, 0x40, 0x84, 0x00, 0x40, 0x81, 0x08, 0x40, 0xf0, 0x00, 0x90, 0x38, 0x1c, 0x04, 0x04,
+    0x3c, 0x89, 0x00, 0x14, 0xa7, 0x00, 0x01, 0x84, 0x00, 0x02, 0x83, 0x01, 0x01, 0x01, 0xbf, 0xbf,
+    0x98, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x10, 0xbe, 0x01, 0x40, 0x80, 0x85, 0x00, 0x40, 0x82,
+    0x00, 0x40, 0x83, 0x06, 0x40, 0x70, 0xa0, 0xe0, 0xb8, 0x8c, 0x84, 0x89, 0x00, 0x10, 0xa7, 0x00,
+    0x01, 0x82, 0x02, 0x01, 0x00, 0x02, 0x85, 0x03, 0x01, 0x03, 0x03, 0x02, 0xc1, 0x03, 0xbf, 0xbf,
+    0x90, 0x00, 0x9b, 0x01, 0x08, 0x14, 0x98, 0x00, 0x10, 0x9d, 0x05, 0x20, 0x00, 0x02, 0x05, 0x02,
+    0x08, 0x9b, 0x00, 0x80, 0x83, 0x02, 0x40, 0x00, 0x40, 0x85, 0x00, 0x80, 0x81, 0x05, 0x80, 0xe0,
+    0x00, 0x20, 0x70, 0x38, 0xb1, 0x00, 0x01, 0x83, 0x01, 0x01, 0x01, 0x82, 0x00, 0x02, 0x83, 0x04,
+    0x02, 0x02, 0x01, 0x00, 0x01, 0xbf, 0xbf, 0x92, 0x00, 0xbf, 0x95, 0x00, 0x20, 0x81, 0x02, 0x02,
+    0x00, 0x08, 0xa0, 0x00, 0x40, 0x87, 0x00, 0x80, 0x83, 0x03, 0x80, 0x60, 0x60, 0x40, 0xb1, 0x00,
+    0x01, 0x84, 0x00, 0x01, 0x82, 0x00, 0x02, 0x81, 0x00, 0x01, 0x82, 0x03, 0x02, 0x00, 0x01, 0x01,
+    0xbf, 0xbf, 0x91, 0x00, 0xbf, 0x94, 0x00, 0x80, 0x82, 0x00, 0x02, 0x9c, 0x00, 0x10, 0x82, 0x00,
+    0x80, 0x8f, 0x01, 0x80, 0xe0, 0xb7, 0x00, 0x01, 0x86, 0x00, 0x01, 0x81, 0x04, 0x04, 0x00, 0x02,
+    0x02, 0x01, 0xbf, 0xbf, 0x91, 0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0xb5, 0x00, 0x80, 0x9f,
+    0x01, 0x10, 0x10, 0x82, 0x00, 0x80, 0x91, 0x00, 0x80, 0xb6, 0x00, 0x01, 0x86, 0x03, 0x02, 0x04,
+    0x00, 0x04, 0x82, 0x00, 0x02, 0xbf, 0xbf, 0x91, 0x00, 0x87, 0x00, 0x10, 0x94, 0x00, 0x08, 0x8a,
+    0x02, 0x40, 0xa0, 0x40, 0x88, 0x02, 0x40, 0xa0, 0x48, 0x9e, 0x02, 0x02, 0x05, 0x02, 0x9a, 0x00,
+    0x10, 0x87, 0x00, 0x20, 0x83, 0x00, 0x40, 0x83, 0x00, 0x40, 0xbf, 0x83, 0x01, 0x02, 0x04, 0x85,
+    0x00, 0x02, 0xbf, 0xbf, 0x90, 0x00, 0x9c, 0x00, 0x08, 0x99, 0x00, 0x08, 0xbf, 0x85, 0x00, 0x20,
+    0x83, 0x00, 0x40, 0x83, 0x00, 0x40, 0xbd, 0x00, 0x02, 0x87, 0x00, 0x01, 0xbf, 0xbf, 0x95, 0x00,
+    0x9c, 0x00, 0x08, 0x95, 0x00, 0x08, 0xbf, 0x91, 0x02, 0x40, 0x00, 0x80, 0xb9, 0x00, 0x40, 0x82,
+    0x01, 0x02, 0x02, 0x86, 0x00, 0x01, 0xbf, 0xbf, 0x95, 0x00, 0x9f, 0x00, 0x10, 0x92, 0x00, 0x08,
+    0xbf, 0x91, 0x02, 0x40, 0x00, 0x80, 0x81, 0x00, 0x80, 0xb6, 0x02, 0x40, 0x00, 0x03, 0x81, 0x01,
+    0x02, 0x01, 0x86, 0x00, 0x01, 0xbf, 0xbf, 0x94, 0x00, 0x9b, 0x01, 0x08, 0x14, 0x81, 0x00, 0x10,
+    0x88, 0x02, 0x40, 0xa0, 0x40, 0x88, 0x02, 0x40, 0xe0, 0x40, 0xbf, 0x8f, 0x00, 0x40, 0x81, 0x00,
+    0x80, 0x8b, 0x00, 0x04, 0xab, 0x00, 0x03, 0x82, 0x00, 0x01, 0x85, 0x01, 0x01, 0x01, 0xbf, 0xbf,
+    0x94, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x40, 0xbf, 0x8a, 0x00, 0x80, 0x84, 0x00, 0x40, 0x8e,
+    0x00, 0x14, 0xb6, 0x01, 0x03, 0x04, 0xbf, 0xbf, 0x94, 0x00, 0xaa, 0x00, 0x40, 0x8a, 0x00, 0x10,
+    0xbf, 0x8a, 0x00, 0x80, 0x94, 0x00, 0x10, 0xb0, 0x00, 0x01, 0x84, 0x03, 0x02, 0x04, 0x00, 0x01,
+    0xbf, 0xbf, 0x92, 0x00, 0xb6, 0x00, 0x10, 0x9d, 0x00, 0x20, 0x83, 0x00, 0x08, 0xbf, 0xae, 0x00,
+    0x01, 0x82, 0x00, 0x01, 0x82, 0x01, 0x02, 0x01, 0xbf, 0xbf, 0x92,
+};
+
+inline constexpr Clip CLIP_FLYOVER = {CLIP_FLYOVER_DATA, sizeof(CLIP_FLYOVER_DATA)};
+
+#endif // FLYOVER_CLIP_H
@@ -0,0 +1,88 @@
+#ifndef FRAME_HASH_H
+#define FRAME_HASH_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Window hash for skipping unchanged frames
+//
+// Hashes the tiles the transfer covers (the window rounded out to whole
+// tiles, see DirtyTiles.h) 32 bits at a time and compares the result with
+// the last frame that was sent. A match means the transfer has nothing to
+// do: the dirty-tile compare would find no changed tile, a full buffer
+// send would rewrite the panel with what it already shows. The caller then
+// skips the transfer and, with the pipeline, the copy and task handoff.
+//
+// Tile rows start on 8 byte boundaries of the buffer, so with an aligned
+// buffer every row is whole words; an unaligned one takes the byte-wise
+// load. A 32 bit collision would leave the panel one frame behind until
+// the next change, which the dirty-tile shadow then catches up with.
+template <typename PanelT>
+class FrameHash {
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int firstByte = PanelT::FIRST_TILE_X * 8;
+    static constexpr int rowWords = PanelT::WINDOW_TILES_WIDE * 8 / 4;
+    static constexpr uint32_t MULTIPLIER = 0x9E3779B1;  // Golden ratio, odd
+
+    uint32_t lastSent;
+    bool haveLast;
+    bool lastUnchanged;
+    unsigned long unchanged;
+    unsigned long hashed;
+
+    static uint32_t mix(uint32_t hash, uint32_t word) {
+        hash ^= word * MULTIPLIER;
+        return ((hash << 13) | (hash >> 19)) * 5 + 0xE6546B64;
+    }
+
+    template <bool ALIGNED>
+    static uint32_t hashRows(const uint8_t *buffer) {
+        uint32_t hash = 0;
+        for (int p = PanelT::FIRST_PAGE; p < PanelT::FIRST_PAGE + PanelT::WINDOW_PAGES; p++) {
+            const uint8_t *row = buffer + p * stride + firstByte;
+            if (ALIGNED) row = (const uint8_t *)__builtin_assume_aligned(row, 4);
+            for (int w = 0; w < rowWords; w++) {
+                uint32_t word;
+                memcpy(&word, row + w * 4, 4);
+                hash = mix(hash, word);
+            }
+        }
+        return hash;
+    }
+
+public:
+    FrameHash() : lastSent(0), haveLast(false), lastUnchanged(false), unchanged(0), hashed(0) {}
+
+    static uint32_t compute(const uint8_t *buffer) {
+        return ((uintptr_t)buffer & 3) == 0 ? hashRows<true>(buffer) : hashRows<false>(buffer);
+    }
+
+    // False when buffer shows what the last sent frame did, otherwise it
+    // becomes the last sent frame. A forced frame is sent (and recorded)
+    // either way, e.g. for a display command that goes with it.
+    bool changed(const uint8_t *buffer, bool force = false) {
+        const uint32_t hash = compute(buffer);
+        hashed++;
+        lastUnchanged = !force && haveLast && hash == lastSent;
+        if (lastUnchanged) {
+            unchanged++;
+            return false;
+        }
+        lastSent = hash;
+        haveLast = true;
+        return true;
+    }
+
+    // Result of the last changed() call
+    bool wasUnchanged() const { return lastUnchanged; }
+    
+    unsigned long getUnchanged() const { return unchanged; }
+    unsigned long getHashed() const { return hashed; }
+
+    void resetStats() {
+        unchanged = hashed = 0;
+    }
+};
+
+#endif // FRAME_HASH_H
@@ -0,0 +1,136 @@
+#ifndef FRAME_MIRROR_H
+#define FRAME_MIRROR_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+#include "ClipPlayer.h"
+
+// Framebuffer mirror over the serial port
+//
+// Streams the rendered 72x40 window so a host can see what the panel shows
+// (tools/mirror_view.py). Each captured frame becomes one clip frame record
+// (see ClipPlayer.h): an XOR delta against the last frame that went out, or
+// a keyframe every MIRROR_KEYFRAME_INTERVAL frames so a viewer that joins
+// late or lost bytes resynchronises.
+//
+// Packet on the wire, in between the plain text log output:
+//   0xA6 'M' sequence(u16) millis(u32) length(u16) record checksum(u8)
+// all little endian; the checksum is the XOR of the record bytes. The
+// sequence counts captured frames, so gaps are frames dropped here.
+//
+// Never blocks the render loop: a packet is written out from the idle hook
+// only as far as the port has room, and frames rendered while one is still
+// going out are dropped. Log output waits until a packet is complete so the
+// two never interleave.
+template <typename PanelT>
+class FrameMirror {
+public:
+    static constexpr uint8_t MARKER = 0xA6;
+    static constexpr uint8_t KIND = 'M';
+    static constexpr size_t HEADER_BYTES = 10;
+
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int shift = PanelT::Y_OFFSET & 7;
+
+    bool enabled;
+    bool haveLast;
+    uint16_t sequence;
+    uint16_t sinceKeyframe;
+    uint16_t packetLength;
+    uint16_t packetSent;
+    unsigned long sentFrames, droppedFrames, keyframes, sentBytes;
+    uint8_t window[ClipFormat::FRAME_BYTES];
+    uint8_t last[ClipFormat::FRAME_BYTES];
+    uint8_t packet[HEADER_BYTES + ClipFormat::MAX_RECORD_BYTES + 1];
+
+    // Window out of the panel buffer, in clip page layout
+    void extract(const uint8_t *buffer) {
+        const uint8_t *src = buffer + PanelT::byteOffset(PanelT::X_OFFSET, PanelT::Y_OFFSET);
+        for (int p = 0; p < ClipFormat::PAGES; p++) {
+            for (int c = 0; c < ClipFormat::WIDTH; c++) {
+                const uint8_t *column = src + p * stride + c;
+                if constexpr (shift == 0) {
+                    window[p * ClipFormat::WIDTH + c] = column[0];
+                } else {
+                    window[p * ClipFormat::WIDTH + c] = (column[0] >> shift) | (column[stride] << (8 - shift));
+                }
+            }
+        }
+    }
+
+public:
+    FrameMirror()
+        : enabled(false), haveLast(false), sequence(0), sinceKeyframe(0),
+          packetLength(0), packetSent(0) {
+        resetStats();
+    }
+
+    // Starting (again) always begins with a keyframe
+    void setEnabled(bool on) {
+        enabled = on;
+        haveLast = false;
+        packetLength = packetSent = 0;
+    }
+
+    bool isEnabled() const { return enabled; }
+
+    // True while a packet is partly written, other output has to wait
+    bool isSending() const { return packetSent < packetLength; }
+
+    // Call once per rendered frame with the buffer about to be sent
+    void capture(const uint8_t *buffer, unsigned long nowMs) {
+        if (!enabled) return;
+        uint16_t frameSequence = sequence++;
+        if (isSending()) {
+            droppedFrames++;
+            return;
+        }
+
+        extract(buffer);
+        const bool key = !haveLast || sinceKeyframe >= MIRROR_KEYFRAME_INTERVAL;
+        uint8_t *record = packet + HEADER_BYTES;
+        size_t length = ClipFormat::encodeFrame(window, key ? nullptr : last, record);
+
+        uint8_t checksum = 0;
+        for (size_t i = 0; i < length; i++) checksum ^= record[i];
+        const uint8_t header[HEADER_BYTES] = {
+            MARKER, KIND, (uint8_t)frameSequence, (uint8_t)(frameSequence >> 8),
+            (uint8_t)nowMs, (uint8_t)(nowMs >> 8), (uint8_t)(nowMs >> 16), (uint8_t)(nowMs >> 24),
+            (uint8_t)length, (uint8_t)(length >> 8),
+        };
+        memcpy(packet, header, HEADER_BYTES);
+        record[length] = checksum;
+
+        packetLength = HEADER_BYTES + length + 1;
+        packetSent = 0;
+        memcpy(last, window, sizeof(last));
+        haveLast = true;
+        sinceKeyframe = key ? 1 : sinceKeyframe + 1;
+        keyframes += key;
+    }
+
+    // Write up to maxBytes of the pending packet, returns the bytes written
+    template <typename Output>
+    size_t drain(Output &out, size_t maxBytes) {
+        size_t count = min((size_t)(packetLength - packetSent), maxBytes);
+        if (count == 0) return 0;
+        out.write(packet + packetSent, count);
+        packetSent += count;
+        sentBytes += count;
+        if (!isSending()) sentFrames++;
+        return count;
+    }
+
+    unsigned long getSentFrames() const { return sentFrames; }
+    unsigned long getDroppedFrames() const { return droppedFrames; }
+    unsigned long getKeyframes() const { return keyframes; }
+    unsigned long getSentBytes() const { return sentBytes; }
+
+    void resetStats() {
+        sentFrames = droppedFrames = keyframes = sentBytes = 0;
+    }
+};
+
+#endif // FRAME_MIRROR_H
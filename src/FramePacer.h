@@ -0,0 +1,147 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#ifdef ESP32
+#include <esp_sleep.h>
+#endif
+
+// Deadline based frame pacing
+//
+// Frames are scheduled on absolute deadlines (start + n * period), so time
+// spent rendering and sending is taken out of the sleep instead of being
+// added to it. A frame that finishes after its deadline is counted as
+// missed; if we fall more than a whole period behind the schedule is
+// restarted from now instead of rendering a burst of catch-up frames.
+//
+// An optional idle task runs first in each frame's slack (e.g. draining the
+// log); the sleep only covers what is left after it.
+//
+// waitForFrameAt() sleeps through whole slots when the caller knows nothing
+// changes before a deadline (render skipping). The next frame still starts
+// on the slot grid, at the first slot at or after it, so skipped frames
+// leave the animation timing as it was. With light sleep on, the long part
+// of a sleep is spent in ESP32 light sleep; nothing else may be using a
+// peripheral then, so flush any transfer first.
+class FramePacer {
+public:
+    typedef void (*IdleTask)(long remainingUs);
+
+private:
+    IdleTask idleTask;
+    unsigned long periodUs;
+    unsigned long nextDeadline;
+    unsigned long missedDeadlines;
+    unsigned long frameCount;
+    unsigned long skippedFrames;
+    unsigned long idleUs;
+    uint16_t lastSkipped;
+    uint8_t targetFps;
+    bool lightSleep;
+
+public:
+    FramePacer(uint8_t fps = DEFAULT_TARGET_FPS)
+        : idleTask(nullptr), periodUs(0), nextDeadline(0), missedDeadlines(0),
+          frameCount(0), skippedFrames(0), idleUs(0), lastSkipped(0), targetFps(0),
+          lightSleep(false) {
+        setTargetFps(fps);
+    }
+
+    // Start the schedule, call once before the first frame
+    void begin() {
+        nextDeadline = micros();
+    }
+
+    void setIdleTask(IdleTask task) { idleTask = task; }
+    void setLightSleep(bool enabled) { lightSleep = enabled; }
+
+    void setTargetFps(uint8_t fps) {
+        targetFps = constrain(fps, (uint8_t)1, MAX_TARGET_FPS);
+        periodUs = 1000000UL / targetFps;
+    }
+
+    // Sleep until the end of the current frame slot
+    void waitForNextFrame() {
+        waitForFrameAt(millis());
+    }
+
+    // Sleep until the first frame slot that starts at or after dueMs, or
+    // the next one if that has passed
+    void waitForFrameAt(unsigned long dueMs) {
+        const unsigned long dueUs = dueMs * 1000UL;
+        uint16_t skipped = 0;
+        if ((long)(dueUs - micros()) > 0) {
+            while ((long)(nextDeadline + periodUs - dueUs) < 0 && skipped < UINT16_MAX) {
+                nextDeadline += periodUs;
+                skipped++;
+            }
+        }
+        nextDeadline += periodUs;
+        frameCount++;
+        skippedFrames += skipped;
+        lastSkipped = skipped;
+
+        long remaining = (long)(nextDeadline - micros());
+        if (remaining <= 0) {
+            missedDeadlines++;
+            if (-remaining > (long)periodUs) {
+                nextDeadline = micros();
+            }
+            return;
+        }
+
+        if (idleTask) {
+            idleTask(remaining);
+            remaining = (long)(nextDeadline - micros());
+            if (remaining <= 0) return;
+        }
+
+        unsigned long sleepStart = micros();
+        #ifdef ESP32
+        if (lightSleep && remaining >= (long)LIGHT_SLEEP_MIN_US) {
+            esp_sleep_enable_timer_wakeup(remaining - LIGHT_SLEEP_WAKE_US);
+            esp_light_sleep_start();
+            remaining = (long)(nextDeadline - micros());
+        }
+        #endif
+        if (remaining >= 1000) {
+            delay(remaining / 1000);
+        }
+        remaining = (long)(nextDeadline - micros());
+        if (remaining > 0) {
+            delayMicroseconds(remaining);
+        }
+        idleUs += micros() - sleepStart;
+    }
+
+    // Time left in the current frame slot, negative when running late
+    long getRemainingUs() const {
+        return (long)(nextDeadline + periodUs - micros());
+    }
+
+    uint8_t getTargetFps() const { return targetFps; }
+    unsigned long getPeriodUs() const { return periodUs; }
+    unsigned long getMissedDeadlines() const { return missedDeadlines; }
+    unsigned long getFrameCount() const { return frameCount; }
+
+    // Slots slept through without a frame, and how many the last wait did
+    unsigned long getSkippedFrames() const { return skippedFrames; }
+    uint16_t getLastSkipped() const { return lastSkipped; }
+
+    // Share of the schedule spent sleeping, 0..1
+    float getIdleFraction() const {
+        const unsigned long slots = frameCount + skippedFrames;
+        return slots > 0 ? (float)idleUs / ((float)slots * periodUs) : 0;
+    }
+
+    void resetStats() {
+        missedDeadlines = 0;
+        frameCount = 0;
+        skippedFrames = 0;
+        idleUs = 0;
+    }
+};
+
+#endif // FRAME_PACER_H
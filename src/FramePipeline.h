@@ -0,0 +1,214 @@
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// Binary semaphore: a FreeRTOS one on the device, mutex + condition
+// variable on the host so the same handoff runs under real threads.
+// create() starts it empty; calling it again reuses the semaphore.
+class BinarySemaphore {
+#ifdef ESP32
+private:
+    SemaphoreHandle_t handle = nullptr;
+
+public:
+    bool create() {
+        if (handle == nullptr) handle = xSemaphoreCreateBinary();
+        else xSemaphoreTake(handle, 0);
+        return handle != nullptr;
+    }
+
+    void give() { xSemaphoreGive(handle); }
+    void take() { xSemaphoreTake(handle, portMAX_DELAY); }
+    bool tryTake() { return xSemaphoreTake(handle, 0) == pdTRUE; }
+#else
+private:
+    std::mutex mutex;
+    std::condition_variable signal;
+    bool available = false;
+
+public:
+    bool create() {
+        std::lock_guard<std::mutex> lock(mutex);
+        available = false;
+        return true;
+    }
+
+    void give() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            available = true;
+        }
+        signal.notify_one();
+    }
+
+    void take() {
+        std::unique_lock<std::mutex> lock(mutex);
+        signal.wait(lock, [this] { return available; });
+        available = false;
+    }
+
+    bool tryTake() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!available) return false;
+        available = false;
+        return true;
+    }
+#endif
+};
+
+// Render/transfer pipeline
+//
+// The frame is rendered into the U8g2 buffer as before. submit() copies it
+// into the pipeline's own transfer buffer and wakes the transfer task, which
+// sends it while loop() goes on to render the next frame into the U8g2
+// buffer. The I2C driver blocks on its interrupt/queue while bytes go out,
+// so even on the single core C3 the CPU renders during the transfer and
+// the frame period drops to max(render, transfer).
+//
+// Handoff: slotFree is held by whoever owns the transfer buffer. submit()
+// takes it (waiting only if the previous frame is still on the bus), copies,
+// and gives frameReady; the task gives slotFree back once the frame is out.
+// A flags byte travels with each frame for display commands that have to go
+// out in order with it (see BannerScroll.h).
+class FramePipeline {
+public:
+    typedef void (*SendFunction)(const uint8_t *frame, uint8_t flags);
+
+private:
+    SendFunction send;
+    uint8_t frame[FRAME_BUFFER_BYTES];
+    uint8_t frameFlags;
+    BinarySemaphore frameReady, slotFree;
+    volatile bool running;
+    volatile bool stopping;
+
+    unsigned long submitted;
+    unsigned long blockedSubmits;
+    volatile unsigned long transferred;
+    volatile unsigned long transferUs;
+
+#ifdef ESP32
+    TaskHandle_t task = nullptr;
+    BinarySemaphore taskExited;
+
+    // Given once the task no longer touches the pipeline, so end() can
+    // return (and begin() start a new task) while it deletes itself
+    static void taskEntry(void *pipeline) {
+        FramePipeline *owner = static_cast<FramePipeline *>(pipeline);
+        owner->transferLoop();
+        owner->taskExited.give();
+        vTaskDelete(nullptr);
+    }
+#else
+    std::thread worker;
+#endif
+
+    void transferLoop() {
+        for (;;) {
+            frameReady.take();
+            if (stopping) break;
+
+            unsigned long start = micros();
+            send(frame, frameFlags);
+            transferUs += micros() - start;
+            transferred++;
+
+            slotFree.give();
+        }
+    }
+
+public:
+    FramePipeline(SendFunction sendFunction)
+        : send(sendFunction), frameFlags(0), running(false), stopping(false),
+          submitted(0), blockedSubmits(0), transferred(0), transferUs(0) {
+        memset(frame, 0, sizeof(frame));
+    }
+
+    // Start the transfer task, the display must already be initialised
+    bool begin() {
+        if (running) return true;
+        if (!frameReady.create() || !slotFree.create()) return false;
+        slotFree.give();
+        stopping = false;
+
+#ifdef ESP32
+        if (!taskExited.create()) return false;
+        if (xTaskCreate(taskEntry, "frame-tx", TRANSFER_TASK_STACK, this,
+                        TRANSFER_TASK_PRIORITY, &task) != pdPASS) {
+            return false;
+        }
+#else
+        worker = std::thread(&FramePipeline::transferLoop, this);
+#endif
+        running = true;
+        return true;
+    }
+
+    // Wait for the last frame to go out and for the task to exit
+    void end() {
+        if (!running) return;
+        flush();
+        stopping = true;
+        frameReady.give();
+#ifdef ESP32
+        taskExited.take();
+        task = nullptr;
+#else
+        worker.join();
+#endif
+        running = false;
+    }
+
+    bool isRunning() const { return running; }
+
+    // Hand a rendered buffer (FRAME_BUFFER_BYTES, U8g2 layout) and its
+    // flags to the transfer task. The caller may draw into it again as soon
+    // as this returns.
+    void submit(const uint8_t *buffer, uint8_t flags = 0) {
+        if (!slotFree.tryTake()) {
+            blockedSubmits++;
+            slotFree.take();
+        }
+        memcpy(frame, buffer, FRAME_BUFFER_BYTES);
+        frameFlags = flags;
+        submitted++;
+        frameReady.give();
+    }
+
+    // Block until the transfer task is idle
+    void flush() {
+        slotFree.take();
+        slotFree.give();
+    }
+
+    unsigned long getSubmitted() const { return submitted; }
+    unsigned long getTransferred() const { return transferred; }
+
+    // Submits that had to wait for the previous transfer (transfer bound)
+    unsigned long getBlockedSubmits() const { return blockedSubmits; }
+
+    float getAverageTransferUs() const {
+        return transferred > 0 ? (float)transferUs / transferred : 0;
+    }
+
+    void resetStats() {
+        submitted = 0;
+        blockedSubmits = 0;
+        transferred = 0;
+        transferUs = 0;
+    }
+};
+
+#endif // FRAME_PIPELINE_H
@@ -0,0 +1,167 @@
+#ifndef I2C_TRANSPORT_H
+#define I2C_TRANSPORT_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <Wire.h>
+#include "config.h"
+
+// U8x8 I2C transport with coalesced transactions and bus statistics
+//
+// U8g2's SSD13xx I2C layer (u8x8_cad_ssd13xx_fast_i2c) sends every command
+// as its own transaction and splits data into 24 byte transactions, each
+// paying for start, address, control byte and stop. cadCallback keeps the
+// same command and data bytes but streams consecutive commands behind one
+// 0x00 control byte and each tile run (up to a page) behind one 0x40,
+// limited only by the Wire buffer. Per tile run that is two transactions
+// instead of three plus one per 24 bytes.
+//
+// byteCallback replaces u8x8_byte_arduino_hw_i2c: it sizes the Wire buffer
+// before Wire.begin(), only reprograms the bus clock when it changes (U8g2
+// sets it before every transaction) and counts transactions, bytes on the
+// bus and the time spent in endTransmission(). It is installed even without
+// coalescing so both framings can be measured.
+//
+// Call attach() before u8g2.begin(). Stats are written from whichever task
+// sends frames, read them as approximate from elsewhere.
+class I2cTransport {
+private:
+    static constexpr uint8_t CONTROL_COMMANDS = 0x00;   // Co = 0, D/C = 0
+    static constexpr uint8_t CONTROL_DATA = 0x40;       // Co = 0, D/C = 1
+    static constexpr size_t DEFAULT_WIRE_BUFFER = 128;  // Wire without setBufferSize()
+
+    static inline size_t maxTransaction = DEFAULT_WIRE_BUFFER;  // Bytes after the address
+    static inline size_t transactionBytes = 0;
+    static inline bool commandsOpen = false;
+    static inline uint32_t appliedClock = 0;
+
+    static inline unsigned long transactions = 0;
+    static inline unsigned long busBytes = 0;
+    static inline unsigned long busUs = 0;
+    static inline unsigned long frames = 0;
+
+    static void beginCommands(u8x8_t *u8x8) {
+        u8x8_byte_StartTransfer(u8x8);
+        u8x8_byte_SendByte(u8x8, CONTROL_COMMANDS);
+        transactionBytes = 1;
+        commandsOpen = true;
+    }
+
+    static void endCommands(u8x8_t *u8x8) {
+        if (!commandsOpen) return;
+        u8x8_byte_EndTransfer(u8x8);
+        commandsOpen = false;
+    }
+
+    // Command or argument byte, appended to the open command stream
+    static void sendCommandByte(u8x8_t *u8x8, uint8_t value) {
+        if (commandsOpen && transactionBytes >= maxTransaction) endCommands(u8x8);
+        if (!commandsOpen) beginCommands(u8x8);
+        u8x8_byte_SendByte(u8x8, value);
+        transactionBytes++;
+    }
+
+public:
+    // SSD13xx/SH1106 I2C command/data framing
+    static uint8_t cadCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+        switch (msg) {
+            case U8X8_MSG_CAD_SEND_CMD:
+            case U8X8_MSG_CAD_SEND_ARG:
+                sendCommandByte(u8x8, arg_int);
+                break;
+            case U8X8_MSG_CAD_SEND_DATA: {
+                endCommands(u8x8);
+                const uint8_t *data = (const uint8_t *)arg_ptr;
+                size_t remaining = arg_int;
+                while (remaining > 0) {
+                    size_t chunk = min(remaining, maxTransaction - 1);
+                    u8x8_byte_StartTransfer(u8x8);
+                    u8x8_byte_SendByte(u8x8, CONTROL_DATA);
+                    u8x8_byte_SendBytes(u8x8, chunk, (uint8_t *)data);
+                    u8x8_byte_EndTransfer(u8x8);
+                    data += chunk;
+                    remaining -= chunk;
+                }
+                break;
+            }
+            case U8X8_MSG_CAD_INIT:
+                if (u8x8->i2c_address == 255) u8x8->i2c_address = 0x78;
+                return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+            case U8X8_MSG_CAD_START_TRANSFER:
+                commandsOpen = false;
+                break;
+            case U8X8_MSG_CAD_END_TRANSFER:
+                endCommands(u8x8);
+                break;
+            default:
+                return 0;
+        }
+        return 1;
+    }
+
+    // Arduino Wire byte transport
+    static uint8_t byteCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+        switch (msg) {
+            case U8X8_MSG_BYTE_SEND:
+                Wire.write((uint8_t *)arg_ptr, (int)arg_int);
+                busBytes += arg_int;
+                break;
+            case U8X8_MSG_BYTE_INIT:
+                if (Wire.setBufferSize(I2C_BUFFER_BYTES) == I2C_BUFFER_BYTES) {
+                    maxTransaction = I2C_BUFFER_BYTES;
+                }
+                if (u8x8->pins[U8X8_PIN_I2C_CLOCK] != U8X8_PIN_NONE &&
+                    u8x8->pins[U8X8_PIN_I2C_DATA] != U8X8_PIN_NONE) {
+                    Wire.begin((int)u8x8->pins[U8X8_PIN_I2C_DATA], (int)u8x8->pins[U8X8_PIN_I2C_CLOCK]);
+                } else {
+                    Wire.begin();
+                }
+                appliedClock = 0;
+                break;
+            case U8X8_MSG_BYTE_SET_DC:
+                break;
+            case U8X8_MSG_BYTE_START_TRANSFER:
+                if (u8x8->bus_clock != appliedClock) {
+                    Wire.setClock(u8x8->bus_clock);
+                    appliedClock = u8x8->bus_clock;
+                }
+                Wire.beginTransmission(u8x8_GetI2CAddress(u8x8) >> 1);
+                busBytes++;  // Address
+                break;
+            case U8X8_MSG_BYTE_END_TRANSFER: {
+                unsigned long start = micros();
+                Wire.endTransmission();
+                busUs += micros() - start;
+                transactions++;
+                break;
+            }
+            default:
+                return 0;
+        }
+        return 1;
+    }
+
+    // Install the byte transport, and the coalescing framing if asked
+    static void attach(U8G2 &display, bool coalesce) {
+        u8x8_t *u8x8 = display.getU8x8();
+        u8x8->byte_cb = byteCallback;
+        if (coalesce) u8x8->cad_cb = cadCallback;
+    }
+
+    // Largest transaction after the address byte, known after begin()
+    static size_t getMaxTransaction() { return maxTransaction; }
+
+    // Count a sent frame, the stats below are averaged over these
+    static void frameSent() { frames++; }
+
+    static unsigned long getFrames() { return frames; }
+    static unsigned long getTransactions() { return transactions; }
+    static unsigned long getBusBytes() { return busBytes; }
+    static unsigned long getBusUs() { return busUs; }
+
+    static void resetStats() {
+        transactions = busBytes = busUs = frames = 0;
+    }
+};
+
+#endif // I2C_TRANSPORT_H
@@ -0,0 +1,120 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <stdarg.h>
+#include "config.h"
+
+// Non-blocking log ring buffer
+//
+// Log calls format into the ring and return; nothing touches the serial
+// port on the render path. The ring is drained in the frame pacer's idle
+// time, only as many bytes as the port can take without blocking. A record
+// that does not fit is dropped whole and counted, the drain reports the
+// count so gaps in the log are visible.
+//
+// Single producer, single consumer: log from loop() only, drain from one
+// place. head and tail are free-running counters, each written by one side.
+template <size_t SIZE>
+class LogRing {
+    static_assert((SIZE & (SIZE - 1)) == 0, "LogRing size must be a power of two");
+
+private:
+    uint8_t data[SIZE];
+    std::atomic<uint32_t> head;       // Written by the producer
+    std::atomic<uint32_t> tail;       // Written by the consumer
+    std::atomic<uint32_t> overflows;  // Records dropped, written by the producer
+    uint32_t reportedOverflows;       // Consumer side
+
+public:
+    LogRing() : head(0), tail(0), overflows(0), reportedOverflows(0) {}
+
+    // Producer: append a whole record or drop it
+    bool write(const char *text, size_t length) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        if (length > SIZE - (h - t)) {
+            overflows.store(overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        size_t offset = h & (SIZE - 1);
+        size_t first = min(length, SIZE - offset);
+        memcpy(data + offset, text, first);
+        memcpy(data, text + first, length - first);
+        head.store(h + length, std::memory_order_release);
+        return true;
+    }
+
+    size_t print(const char *text) {
+        size_t length = strlen(text);
+        return write(text, length) ? length : 0;
+    }
+
+    size_t println(const char *text = "") {
+        char line[LOG_LINE_MAX];
+        int length = snprintf(line, sizeof(line), "%s\n", text);
+        return write(line, min((size_t)length, sizeof(line) - 1)) ? length : 0;
+    }
+
+    size_t vprintf(const char *format, va_list args) {
+        char line[LOG_LINE_MAX];
+        int length = vsnprintf(line, sizeof(line), format, args);
+        if (length < 0) return 0;
+        return write(line, min((size_t)length, sizeof(line) - 1)) ? length : 0;
+    }
+
+    __attribute__((format(printf, 2, 3)))
+    size_t printf(const char *format, ...) {
+        va_list args;
+        va_start(args, format);
+        size_t length = vprintf(format, args);
+        va_end(args);
+        return length;
+    }
+
+    // Consumer: move up to maxBytes to out (anything with write(ptr, n)),
+    // returns the bytes written
+    template <typename Output>
+    size_t drain(Output &out, size_t maxBytes) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        size_t pending = min((size_t)(h - t), maxBytes);
+        size_t written = 0;
+        while (written < pending) {
+            size_t offset = (t + written) & (SIZE - 1);
+            size_t chunk = min(pending - written, SIZE - offset);
+            out.write(data + offset, chunk);
+            written += chunk;
+        }
+        tail.store(t + written, std::memory_order_release);
+
+        // Records are dropped when the ring is full, so the gap sits after
+        // what was queued: report it once that is out, on a line of its own
+        uint32_t dropped = overflows.load(std::memory_order_relaxed);
+        if (t + written == h && dropped != reportedOverflows && maxBytes - written >= 48) {
+            char notice[48];
+            int length = snprintf(notice, sizeof(notice), "[log] %lu records dropped\n",
+                                  (unsigned long)(dropped - reportedOverflows));
+            out.write((const uint8_t *)notice, length);
+            reportedOverflows = dropped;
+            written += length;
+        }
+        return written;
+    }
+
+    size_t getPending() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    // Producer: room for a write() that won't be dropped
+    size_t getFree() const { return SIZE - getPending(); }
+
+    uint32_t getOverflows() const { return overflows.load(std::memory_order_relaxed); }
+};
+
+// The application log, drained from loop() via the frame pacer's idle hook
+inline LogRing<LOG_RING_BYTES> logRing;
+
+#endif // LOG_RING_H
@@ -0,0 +1,148 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <Arduino.h>
+#include <type_traits>
+#include "config.h"
+#include "LogRing.h"
+
+// Leveled logging
+//
+//   LOG_WARN("Slow frame detected: %lu us\n", frameTime);
+//
+// Levels above LOG_LEVEL compile to nothing. Records go to the log ring
+// (see LogRing.h), either as formatted text or, with LOG_TOKENIZED, as a
+// token: the format string is replaced at compile time by its 32-bit
+// FNV-1a hash and only the hash and the raw arguments are sent. The
+// format strings never reach the device; tools/log_tokens.py collects
+// them into the build's token table and tools/log_decode.py turns the
+// binary stream back into text.
+//
+// Token record on the wire:
+//   0xA5, payload length, token (4 bytes LE), arguments
+// Integers are zigzag varints (signedness comes from the format), floats
+// are 4 byte IEEE, strings are a length byte and the bytes. The length
+// counts payload bytes before escaping: after the marker every 0xA5, 0xA6
+// (the mirror packet marker, see FrameMirror.h) or 0xA7 byte goes out as
+// 0xA7 and the byte XOR 0x20, so a record never looks like the start of a
+// record or packet to a reader scanning for one. Anything that is not a
+// 0xA5 record (benchmark output, command replies) is plain text.
+enum DebugLevel {
+    DEBUG_ERROR = 0,
+    DEBUG_WARN = 1,
+    DEBUG_INFO = 2,
+    DEBUG_VERBOSE = 3
+};
+
+constexpr uint8_t LOG_TOKEN_MARKER = 0xA5;
+constexpr uint8_t LOG_TOKEN_ESCAPE = 0xA7;
+
+constexpr uint32_t logToken(const char *format) {
+    uint32_t hash = 2166136261u;
+    while (*format) {
+        hash = (hash ^ (uint8_t)*format++) * 16777619u;
+    }
+    return hash;
+}
+
+class TokenRecord {
+private:
+    uint8_t data[LOG_LINE_MAX];
+    size_t length;
+
+    void put(uint8_t value) {
+        if (length < sizeof(data)) data[length++] = value;
+    }
+
+    void putVarint(uint64_t value) {
+        while (value >= 0x80) {
+            put((uint8_t)value | 0x80);
+            value >>= 7;
+        }
+        put((uint8_t)value);
+    }
+
+public:
+    explicit TokenRecord(uint32_t token) : length(0) {
+        put(LOG_TOKEN_MARKER);
+        put(0);  // Payload length, patched in finish()
+        for (int i = 0; i < 4; i++) put(token >> (i * 8));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+    add(T value) {
+        int64_t wide = (int64_t)value;
+        putVarint(((uint64_t)wide << 1) ^ (uint64_t)(wide >> 63));
+    }
+
+    void add(double value) {
+        float narrow = (float)value;
+        uint32_t bits;
+        memcpy(&bits, &narrow, sizeof(bits));
+        for (int i = 0; i < 4; i++) put(bits >> (i * 8));
+    }
+
+    void add(const char *text) {
+        size_t count = min(strlen(text), (size_t)255);
+        put(count);
+        for (size_t i = 0; i < count; i++) put(text[i]);
+    }
+
+    void addAll() {}
+
+    template <typename First, typename... Rest>
+    void addAll(First first, Rest... rest) {
+        add(first);
+        addAll(rest...);
+    }
+
+    // Whole record to the ring, escaped, dropped if it was truncated
+    void finish() {
+        if (length >= sizeof(data)) return;
+        data[1] = length - 2;
+
+        uint8_t wire[2 * LOG_LINE_MAX];
+        size_t wireLength = 0;
+        wire[wireLength++] = LOG_TOKEN_MARKER;
+        for (size_t i = 1; i < length; i++) {
+            const uint8_t value = data[i];
+            if (value >= LOG_TOKEN_MARKER && value <= LOG_TOKEN_ESCAPE) {
+                wire[wireLength++] = LOG_TOKEN_ESCAPE;
+                wire[wireLength++] = value ^ 0x20;
+            } else {
+                wire[wireLength++] = value;
+            }
+        }
+        logRing.write((const char *)wire, wireLength);
+    }
+};
+
+template <typename... Args>
+inline void writeTokenRecord(uint32_t token, Args... args) {
+    TokenRecord record(token);
+    record.addAll(args...);
+    record.finish();
+}
+
+// The text branch is compiled either way, so format/argument mismatches are
+// still reported in tokenized builds
+#define LOG_AT(level, format, ...)                                          \
+    do {                                                                    \
+        if constexpr ((level) <= LOG_LEVEL) {                               \
+            if constexpr (LOG_TOKENIZED) {                                  \
+                constexpr uint32_t logTokenId = logToken(format);           \
+                writeTokenRecord(logTokenId, ##__VA_ARGS__);                \
+            } else {                                                        \
+                logRing.printf(format, ##__VA_ARGS__);                      \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+// Errors and warnings carry their level in the text
+#define LOG_ERROR(format, ...) LOG_AT(DEBUG_ERROR, "[ERROR] " format, ##__VA_ARGS__)
+#define LOG_WARN(format, ...) LOG_AT(DEBUG_WARN, "[WARN] " format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...) LOG_AT(DEBUG_INFO, format, ##__VA_ARGS__)
+#define LOG_VERBOSE(format, ...) LOG_AT(DEBUG_VERBOSE, format, ##__VA_ARGS__)
+
+#endif // LOGGING_H
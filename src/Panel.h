@@ -0,0 +1,86 @@
+#ifndef PANEL_H
+#define PANEL_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// Panel descriptors
+//
+// Everything that depends on the display variant: the U8g2 constructor, the
+// size of its full buffer and where the 72x40 animation window sits in it.
+// The renderer (dirty tiles, background cache, pixel kernels, sprite blits)
+// is templated on the descriptor, so buffer strides and window offsets are
+// compile-time constants and fold into the addressing. Raw controller
+// access (the banner's hardware scroll) also needs the controller column of
+// buffer column 0 and whether the controller scrolls horizontally.
+//
+// The variant is picked at build time, one PlatformIO environment each:
+//   (default)                  128x64 NONAME, window centred at 30,12
+//   -DPANEL_SH1106_72X40_WISE  native 72x40, 360 byte buffer
+//   -DPANEL_SSD1306_72X40_ER   native 72x40, 360 byte buffer
+template <typename DisplayType, int BUFFER_W, int BUFFER_H, int WINDOW_X, int WINDOW_Y,
+          uint32_t BUS_CLOCK, int COLUMN_OFFSET, bool SCROLL>
+struct PanelDescriptor {
+    typedef DisplayType Display;
+
+    // Fastest I2C clock the controller is run at, caps I2C_FREQUENCY
+    static constexpr uint32_t MAX_BUS_CLOCK = BUS_CLOCK;
+
+    // Controller RAM column of buffer column 0 (U8g2's x offset)
+    static constexpr int CONTROLLER_COLUMN = COLUMN_OFFSET;
+
+    // SSD1306 style horizontal scroll (0x26/0x27, 0x2E/0x2F)
+    static constexpr bool HORIZONTAL_SCROLL = SCROLL;
+
+    // U8g2 full buffer: BUFFER_WIDTH bytes per 8 pixel page
+    static constexpr int BUFFER_WIDTH = BUFFER_W;
+    static constexpr int BUFFER_HEIGHT = BUFFER_H;
+    static constexpr int BUFFER_TILE_WIDTH = BUFFER_W / 8;
+    static constexpr int BUFFER_TILE_HEIGHT = BUFFER_H / 8;
+    static constexpr size_t BUFFER_BYTES = BUFFER_W * BUFFER_H / 8;
+
+    // Animation window in buffer pixels
+    static constexpr int WINDOW_WIDTH = 72;
+    static constexpr int WINDOW_HEIGHT = 40;
+    static constexpr int X_OFFSET = WINDOW_X;
+    static constexpr int Y_OFFSET = WINDOW_Y;
+
+    // Tiles (8x8) and pages the window touches
+    static constexpr int FIRST_TILE_X = WINDOW_X / 8;
+    static constexpr int FIRST_PAGE = WINDOW_Y / 8;
+    static constexpr int WINDOW_TILES_WIDE = (WINDOW_X + WINDOW_WIDTH + 7) / 8 - FIRST_TILE_X;
+    static constexpr int WINDOW_PAGES = (WINDOW_Y + WINDOW_HEIGHT + 7) / 8 - FIRST_PAGE;
+
+    static_assert(BUFFER_W % 8 == 0 && BUFFER_H % 8 == 0, "Buffer must be whole tiles");
+    static_assert(WINDOW_X >= 0 && WINDOW_X + WINDOW_WIDTH <= BUFFER_W &&
+                  WINDOW_Y >= 0 && WINDOW_Y + WINDOW_HEIGHT <= BUFFER_H,
+                  "Animation window must fit the buffer");
+
+    // Byte holding pixel (x, y)
+    static constexpr int byteOffset(int x, int y) { return (y >> 3) * BUFFER_WIDTH + x; }
+};
+
+// 128x64 controller driven with manual offsets. The glass shows 72 columns
+// centred as if the controller were 132 wide, hence 30 and not 28.
+// Every controller is held to the 400 kHz its datasheet specifies. Many
+// SSD1306 modules take Fast-mode Plus (1 MHz): that is an opt-in, raise the
+// panel's bus clock here and I2C_FREQUENCY in config.h. SH1106 has no
+// scroll commands.
+typedef PanelDescriptor<U8G2_SSD1306_128X64_NONAME_F_HW_I2C, 128, 64, 30, 12, 400000, 0, true>
+    PanelNoname128x64;
+
+// Native 72x40 drivers, U8g2 handles the column offset in the controller
+typedef PanelDescriptor<U8G2_SH1106_72X40_WISE_F_HW_I2C, 72, 40, 0, 0, 400000, 30, false>
+    PanelSh1106Wise72x40;
+typedef PanelDescriptor<U8G2_SSD1306_72X40_ER_F_HW_I2C, 72, 40, 0, 0, 400000, 28, true>
+    PanelSsd1306Er72x40;
+
+#if defined(PANEL_SH1106_72X40_WISE)
+typedef PanelSh1106Wise72x40 Panel;
+#elif defined(PANEL_SSD1306_72X40_ER)
+typedef PanelSsd1306Er72x40 Panel;
+#else
+typedef PanelNoname128x64 Panel;
+#endif
+
+#endif // PANEL_H
@@ -0,0 +1,60 @@
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// Direct framebuffer pixel kernels
+//
+// Small plotting primitives that write straight into the U8g2 buffer using
+// the SSD1306 page layout (byte = 8 vertical pixels of one column, LSB on
+// top). Each call does a single clip test against the animation window
+// instead of going through U8g2's per-call clipping and dispatch. Meant for
+// batched passes over many particles. Window and stride are the panel's
+// compile-time constants (see Panel.h).
+template <typename PanelT>
+class PixelKernels {
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int left = PanelT::X_OFFSET;   // Window, right/bottom exclusive
+    static constexpr int top = PanelT::Y_OFFSET;
+    static constexpr int right = PanelT::X_OFFSET + PanelT::WINDOW_WIDTH;
+    static constexpr int bottom = PanelT::Y_OFFSET + PanelT::WINDOW_HEIGHT;
+
+    uint8_t *buffer;
+
+public:
+    explicit PixelKernels(U8G2 &display) : buffer(display.getBufferPtr()) {}
+
+    inline bool contains(int x, int y) const {
+        return x >= left && x < right && y >= top && y < bottom;
+    }
+
+    inline void setPixel(int x, int y) {
+        if (!contains(x, y)) return;
+        buffer[(y >> 3) * stride + x] |= 1 << (y & 7);
+    }
+
+    // Vertical run of h pixels starting at (x, y), at most one byte per page
+    inline void setVSpan(int x, int y, int h) {
+        if (x < left || x >= right) return;
+        int y1 = y + h;
+        if (y < top) y = top;
+        if (y1 > bottom) y1 = bottom;
+
+        uint8_t *column = buffer + x;
+        while (y < y1) {
+            int bit = y & 7;
+            int count = min(8 - bit, y1 - y);
+            column[(y >> 3) * stride] |= ((1 << count) - 1) << bit;
+            y += count;
+        }
+    }
+
+    inline void setBlock2x2(int x, int y) {
+        setVSpan(x, y, 2);
+        setVSpan(x + 1, y, 2);
+    }
+};
+
+#endif // PIXEL_KERNELS_H
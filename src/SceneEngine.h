@@ -0,0 +1,108 @@
+#ifndef SCENE_ENGINE_H
+#define SCENE_ENGINE_H
+
+#include <Arduino.h>
+
+// Display-list scene engine
+//
+// A scene is two constexpr lists of draw operations: a static background
+// (what BackgroundCache captures) and the moving foreground drawn over it
+// every frame. Each operation names the object it draws, an optional
+// update step that runs every frame, and a bounding box (fixed, or a
+// function for moving objects). Objects whose box misses the window are
+// culled: their update still runs so animations keep their timing, only
+// the drawing is skipped. Scenes are registered by listing them in a
+// constexpr table; picking one is an array index, not a switch. Every
+// operation is timed into the profiler zone of the same index as its object.
+struct Bounds {
+    int16_t x, y, w, h;
+};
+
+struct DrawOp {
+    uint8_t object;         // Index into the engine's per-object counters
+    void (*update)();       // Every frame, may be null
+    void (*draw)();
+    Bounds (*bounds)();     // Null when the box below is fixed
+    Bounds box;
+};
+
+struct SceneDefinition {
+    const char *name;
+    const DrawOp *background;
+    uint8_t backgroundCount;
+    const DrawOp *foreground;
+    uint8_t foregroundCount;
+};
+
+// Scene entry with the list lengths taken from the arrays
+template <size_t BACKGROUND, size_t FOREGROUND>
+constexpr SceneDefinition makeScene(const char *name, const DrawOp (&background)[BACKGROUND],
+                                    const DrawOp (&foreground)[FOREGROUND]) {
+    return {name, background, (uint8_t)BACKGROUND, foreground, (uint8_t)FOREGROUND};
+}
+
+template <uint8_t OBJECTS, typename Profiler>
+class SceneEngine {
+private:
+    Profiler &profiler;
+    const SceneDefinition *scenes;
+    uint8_t sceneCount;
+    const char *const *objectNames;
+    Bounds window;
+    unsigned long drawn[OBJECTS];
+    unsigned long culled[OBJECTS];
+
+    bool visible(const Bounds &b) const {
+        return b.x < window.x + window.w && b.x + b.w > window.x &&
+               b.y < window.y + window.h && b.y + b.h > window.y;
+    }
+
+    void run(const DrawOp *ops, uint8_t count) {
+        for (uint8_t i = 0; i < count; i++) {
+            const DrawOp &op = ops[i];
+            typename Profiler::Scope zone(profiler, op.object);
+            if (op.update) op.update();
+            if (!visible(op.bounds ? op.bounds() : op.box)) {
+                culled[op.object]++;
+                continue;
+            }
+            op.draw();
+            drawn[op.object]++;
+        }
+    }
+
+public:
+    // names needs at least OBJECTS entries
+    template <size_t SCENES>
+    SceneEngine(Profiler &zoneProfiler, const SceneDefinition (&sceneTable)[SCENES],
+                const char *const *names, int x, int y, int w, int h)
+        : profiler(zoneProfiler), scenes(sceneTable), sceneCount(SCENES), objectNames(names),
+          window{(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h} {
+        resetStats();
+    }
+
+    void drawBackground(uint8_t scene) {
+        if (scene < sceneCount) run(scenes[scene].background, scenes[scene].backgroundCount);
+    }
+
+    void drawForeground(uint8_t scene) {
+        if (scene < sceneCount) run(scenes[scene].foreground, scenes[scene].foregroundCount);
+    }
+
+    uint8_t getSceneCount() const { return sceneCount; }
+    const char *getSceneName(uint8_t scene) const {
+        return scene < sceneCount ? scenes[scene].name : "";
+    }
+
+    unsigned long getDrawn(uint8_t object) const { return drawn[object]; }
+    unsigned long getCulled(uint8_t object) const { return culled[object]; }
+
+    const char *getObjectName(uint8_t object) const { return objectNames[object]; }
+
+    void resetStats() {
+        memset(drawn, 0, sizeof(drawn));
+        memset(culled, 0, sizeof(culled));
+    }
+};
+
+#endif // SCENE_ENGINE_H
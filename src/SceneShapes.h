@@ -0,0 +1,82 @@
+#ifndef SCENE_SHAPES_H
+#define SCENE_SHAPES_H
+
+// Static scene shapes, written once against the U8g2 drawing API.
+//
+// Each shape is a template over the draw target so the same code renders
+// live into the display (U8G2) and at compile time into a SpriteCanvas for
+// the sprite atlas. Coordinates are relative to the shape's anchor point.
+
+template <typename Target>
+constexpr void drawTreeShape(Target &t, int treeX, int treeY) {
+    // Tree triangles
+    for (int i = 0; i < 3; i++) {
+        int triangleSize = 12 - (i * 3);
+        t.drawTriangle(
+            treeX, treeY - (i * 8) - triangleSize,
+            treeX - triangleSize, treeY - (i * 8),
+            treeX + triangleSize, treeY - (i * 8)
+        );
+
+        // Decorations (baubles) on each level
+        int level_y = treeY - (i * 8) - 2;
+        int max_width = triangleSize - 2;
+        t.drawPixel(treeX - max_width/2, level_y);
+        t.drawPixel(treeX + max_width/2, level_y);
+    }
+
+    // Trunk
+    t.drawBox(treeX - 2, treeY, 4, 5);
+}
+
+// Snowman without the animated arms
+template <typename Target>
+constexpr void drawSnowmanShape(Target &t, int snowmanX, int snowmanY) {
+    // Bottom, middle and head circles
+    t.drawDisc(snowmanX, snowmanY, 4);
+    t.drawDisc(snowmanX, snowmanY - 6, 3);
+    t.drawDisc(snowmanX, snowmanY - 11, 2);
+
+    // Eyes (empty to stand out against the filled head)
+    t.setDrawColor(0);
+    t.drawPixel(snowmanX - 1, snowmanY - 12);
+    t.drawPixel(snowmanX + 1, snowmanY - 12);
+    t.setDrawColor(1);
+
+    // Carrot nose
+    t.drawPixel(snowmanX, snowmanY - 11);
+    t.drawPixel(snowmanX + 1, snowmanY - 11);
+
+    // Scarf
+    t.drawLine(snowmanX - 2, snowmanY - 8,
+               snowmanX + 2, snowmanY - 8);
+    t.drawLine(snowmanX + 2, snowmanY - 8,
+               snowmanX + 2, snowmanY - 6);
+}
+
+template <typename Target>
+constexpr void drawPresentShape(Target &t, int x, int y, int w, int h) {
+    // Box
+    t.drawBox(x - w/2, y - h, w, h);
+
+    // Ribbon
+    t.drawLine(x, y - h, x, y - h - 2);
+    t.drawLine(x - w/2 + 1, y - h/2, x + w/2 - 1, y - h/2);
+
+    // Bow
+    t.drawPixel(x - 1, y - h - 2);
+    t.drawPixel(x + 1, y - h - 2);
+}
+
+template <typename Target>
+constexpr void drawMoonShape(Target &t, int moonX, int moonY) {
+    // Full moon
+    t.drawDisc(moonX, moonY, 3);
+
+    // Shadow to make crescent
+    t.setDrawColor(0);
+    t.drawDisc(moonX + 1, moonY, 2);
+    t.setDrawColor(1);
+}
+
+#endif // SCENE_SHAPES_H
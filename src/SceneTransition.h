@@ -0,0 +1,223 @@
+#ifndef SCENE_TRANSITION_H
+#define SCENE_TRANSITION_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "TweenEngine.h"
+
+// Scene transitions composited a word at a time
+//
+// For the length of a transition each frame is rendered twice: the
+// outgoing scene first, its window tiles captured into a 1bpp layer, then
+// the incoming scene into the buffer as usual. composite() merges the two
+// 32 bits (4 columns of a page) at a time:
+//
+//     frame = outgoing ^ ((outgoing ^ incoming) & mask)
+//
+// taking incoming pixels where the mask is set. Masks never go through
+// U8g2's pixel calls: the wipes build them from the edge position, the
+// dissolve and crossfade read them from ordered-dither tables generated at
+// compile time (a threshold per pixel; level L sets every pixel whose
+// threshold is below L). A page byte is 8 rows of one column, so a mask
+// pattern 8 rows high is one byte per column and the same for every page.
+//
+// The layer covers the tiles the transfer does (window rounded out to whole
+// tiles, as in FrameHash.h); tile rows start on 8 byte boundaries, so an
+// aligned buffer is whole words. Call begin() at the scene change, then per
+// frame capture() after rendering the outgoing scene and composite() after
+// the incoming one while isActive().
+enum TransitionKind : uint8_t {
+    TRANSITION_WIPE_RIGHT,  // Incoming scene pushed in from the left edge
+    TRANSITION_WIPE_DOWN,   // From the top edge
+    TRANSITION_DISSOLVE,    // Pixels in a scattered order
+    TRANSITION_CROSSFADE,   // Ordered (Bayer) dither from one to the other
+    TRANSITION_COUNT
+};
+
+constexpr int DITHER_LEVELS = 64;   // Mask levels 0 (outgoing) .. 64 (incoming)
+constexpr int BAYER_COLUMNS = 8;    // Mask repeats every this many columns
+constexpr int NOISE_COLUMNS = 16;
+
+// Threshold of column x, row y of the 8x8 Bayer matrix, 0..63
+constexpr int bayerThreshold(int x, int y) {
+    int value = 0;
+    for (int bit = 0; bit < 3; bit++) {
+        value = (value << 2) | ((((x ^ y) >> bit) & 1) << 1) | ((y >> bit) & 1);
+    }
+    return value;
+}
+
+struct DitherMasks {
+    uint8_t bayer[DITHER_LEVELS + 1][BAYER_COLUMNS];
+    uint8_t noise[DITHER_LEVELS + 1][NOISE_COLUMNS];
+};
+
+// Table generation, only evaluated by the compiler. The dissolve's
+// thresholds are a shuffled 16x8 ramp, every level adds two pixels of each
+// 128 wherever they happen to be.
+constexpr DitherMasks buildDitherMasks() {
+    DitherMasks masks = {};
+    uint8_t noise[NOISE_COLUMNS * 8] = {};
+    for (int i = 0; i < NOISE_COLUMNS * 8; i++) noise[i] = i / 2;
+    uint32_t seed = 0x2545F491;
+    for (int i = NOISE_COLUMNS * 8 - 1; i > 0; i--) {
+        seed = seed * 1664525 + 1013904223;
+        const int j = (seed >> 8) % (i + 1);
+        const uint8_t swap = noise[i];
+        noise[i] = noise[j];
+        noise[j] = swap;
+    }
+
+    for (int level = 0; level <= DITHER_LEVELS; level++) {
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < BAYER_COLUMNS; x++) {
+                if (bayerThreshold(x, y) < level) masks.bayer[level][x] |= 1 << y;
+            }
+            for (int x = 0; x < NOISE_COLUMNS; x++) {
+                if (noise[y * NOISE_COLUMNS + x] < level) masks.noise[level][x] |= 1 << y;
+            }
+        }
+    }
+    return masks;
+}
+
+inline constexpr DitherMasks DITHER_MASKS PROGMEM = buildDitherMasks();
+
+static_assert(DITHER_MASKS.bayer[0][0] == 0x00 && DITHER_MASKS.bayer[DITHER_LEVELS][7] == 0xFF,
+              "Level 0 is all outgoing, the top level all incoming");
+static_assert(DITHER_MASKS.noise[DITHER_LEVELS][NOISE_COLUMNS - 1] == 0xFF,
+              "Every noise threshold is below the top level");
+
+template <typename PanelT>
+class SceneTransition {
+private:
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int firstByte = PanelT::FIRST_TILE_X * 8;
+    static constexpr int rowBytes = PanelT::WINDOW_TILES_WIDE * 8;
+    static constexpr int rowWords = rowBytes / 4;
+    static constexpr int pages = PanelT::WINDOW_PAGES;
+
+    static_assert(BAYER_COLUMNS % 4 == 0 && NOISE_COLUMNS % 4 == 0,
+                  "Mask words must not straddle a period");
+
+    uint32_t outgoing[pages * rowWords];
+    uint8_t fromScene;
+    TransitionKind kind;
+    unsigned long startMs;
+    uint16_t durationMs;
+    bool active;
+    unsigned long transitions;
+
+    // Mask words of one tile row, the same on every page; the wipe down
+    // narrows them per page in composite()
+    static void rowMask(TransitionKind kind, uint32_t progress, uint32_t *mask) {
+        switch (kind) {
+            case TRANSITION_WIPE_RIGHT: {
+                // Eased, so the edge starts and stops gently
+                const int edge = PanelT::X_OFFSET - firstByte +
+                                 (int)((ease(EASE_SINE, progress) * PanelT::WINDOW_WIDTH) >> 16);
+                const int columns = constrain(edge, 0, rowBytes);
+                memset(mask, 0xFF, columns);
+                memset((uint8_t *)mask + columns, 0x00, rowBytes - columns);
+                break;
+            }
+            case TRANSITION_DISSOLVE:
+            case TRANSITION_CROSSFADE: {
+                const int level = (progress * DITHER_LEVELS) >> 16;
+                const bool noise = kind == TRANSITION_DISSOLVE;
+                const uint8_t *pattern = noise ? DITHER_MASKS.noise[level] : DITHER_MASKS.bayer[level];
+                const int period = noise ? NOISE_COLUMNS : BAYER_COLUMNS;
+                for (int w = 0; w < rowWords; w++) {
+                    memcpy(&mask[w], pattern + (firstByte + w * 4) % period, 4);
+                }
+                break;
+            }
+            default:
+                for (int w = 0; w < rowWords; w++) mask[w] = 0xFFFFFFFF;
+                break;
+        }
+    }
+
+    // Rows of page p above the wipe's edge, one byte replicated to a word
+    static uint32_t wipeDownMask(uint32_t progress, int page) {
+        const int edge = PanelT::Y_OFFSET +
+                         (int)((ease(EASE_SINE, progress) * PanelT::WINDOW_HEIGHT) >> 16);
+        const int rows = constrain(edge - page * 8, 0, 8);
+        return ((1UL << rows) - 1) * 0x01010101;
+    }
+
+public:
+    SceneTransition()
+        : fromScene(0), kind(TRANSITION_WIPE_RIGHT), startMs(0), durationMs(1), active(false),
+          transitions(0) {
+        memset(outgoing, 0, sizeof(outgoing));
+    }
+
+    // Blend from scene `from` into whatever is rendered next. startedMs may
+    // lie in the past, so the first frame already shows some movement.
+    void begin(uint8_t from, TransitionKind transitionKind, uint16_t duration, unsigned long startedMs) {
+        fromScene = from;
+        kind = transitionKind;
+        durationMs = max(duration, (uint16_t)1);
+        startMs = startedMs;
+        active = true;
+        transitions++;
+    }
+
+    void cancel() { active = false; }
+
+    // Still blending at nowMs, ends the transition once it has run its time
+    bool isActive(unsigned long nowMs) {
+        if (active && nowMs - startMs >= durationMs) active = false;
+        return active;
+    }
+
+    uint8_t getOutgoingScene() const { return fromScene; }
+    TransitionKind getKind() const { return kind; }
+
+    // Q0.16 share of the way through at nowMs
+    uint32_t progress(unsigned long nowMs) const {
+        const uint32_t elapsed = min(nowMs - startMs, (unsigned long)durationMs);
+        return (elapsed << 16) / durationMs;
+    }
+
+    // Take the outgoing scene's tiles from the buffer it was rendered into
+    void capture(const uint8_t *buffer) {
+        for (int p = 0; p < pages; p++) {
+            memcpy(outgoing + p * rowWords, buffer + (PanelT::FIRST_PAGE + p) * stride + firstByte,
+                   rowBytes);
+        }
+    }
+
+    // Merge the captured outgoing layer into the buffer, which holds the
+    // incoming scene
+    void composite(uint8_t *buffer, unsigned long nowMs) const {
+        composite(buffer, outgoing, kind, progress(nowMs));
+    }
+
+    static void composite(uint8_t *buffer, const uint32_t *layer, TransitionKind kind,
+                          uint32_t progress) {
+        uint32_t mask[rowWords];
+        rowMask(kind, progress, mask);
+        for (int p = 0; p < pages; p++) {
+            const int page = PanelT::FIRST_PAGE + p;
+            const uint32_t pageMask = kind == TRANSITION_WIPE_DOWN ? wipeDownMask(progress, page)
+                                                                   : 0xFFFFFFFF;
+            uint8_t *row = buffer + page * stride + firstByte;
+            const uint32_t *from = layer + p * rowWords;
+            for (int w = 0; w < rowWords; w++) {
+                uint32_t to;
+                memcpy(&to, row + w * 4, 4);
+                const uint32_t blended = from[w] ^ ((from[w] ^ to) & mask[w] & pageMask);
+                memcpy(row + w * 4, &blended, 4);
+            }
+        }
+    }
+
+    const uint32_t *getLayer() const { return outgoing; }
+
+    unsigned long getTransitions() const { return transitions; }
+    void resetStats() { transitions = 0; }
+};
+
+#endif // SCENE_TRANSITION_H
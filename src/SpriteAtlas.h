@@ -0,0 +1,306 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "SceneShapes.h"
+
+// Compile-time sprite atlas
+//
+// The static scene shapes are rasterized by the compiler into 1bpp bitmaps
+// plus masks and end up in flash as plain constant data. Sprites are stored
+// in the SSD1306 page layout of the U8g2 buffer (one byte per column per
+// 8 rows, LSB on top) so a blit is a shift and a masked OR per column byte.
+
+// Sprite as seen by the blitter
+struct Sprite {
+    uint8_t width;
+    uint8_t height;
+    uint8_t anchorX;    // Anchor point inside the sprite, (x, y) passed to
+    uint8_t anchorY;    // blitSprite() lands here
+    const uint8_t *bits;
+    const uint8_t *mask;
+};
+
+// U8g2-style rasterizer usable in constant expressions. Pixels drawn with
+// color 1 set bits, color 0 clears them; both mark the mask so cleared
+// pixels (eyes, moon shadow) punch through whatever is underneath.
+template <int W, int H>
+struct SpriteCanvas {
+    static constexpr int PAGES = (H + 7) / 8;
+
+    uint8_t bits[W * PAGES];
+    uint8_t mask[W * PAGES];
+    int anchorX, anchorY;
+    uint8_t color;
+
+    constexpr SpriteCanvas(int ax, int ay)
+        : bits{}, mask{}, anchorX(ax), anchorY(ay), color(1) {}
+
+    constexpr void setDrawColor(uint8_t c) { color = c; }
+
+    constexpr void drawPixel(int x, int y) {
+        x += anchorX;
+        y += anchorY;
+        if (x < 0 || y < 0 || x >= W || y >= H) return;
+        int index = (y >> 3) * W + x;
+        uint8_t bit = 1 << (y & 7);
+        mask[index] |= bit;
+        if (color) bits[index] |= bit;
+        else bits[index] &= ~bit;
+    }
+
+    constexpr void drawHLine(int x, int y, int w) {
+        for (int i = 0; i < w; i++) drawPixel(x + i, y);
+    }
+
+    constexpr void drawVLine(int x, int y, int h) {
+        for (int i = 0; i < h; i++) drawPixel(x, y + i);
+    }
+
+    constexpr void drawBox(int x, int y, int w, int h) {
+        for (int j = 0; j < h; j++) drawHLine(x, y + j, w);
+    }
+
+    constexpr void drawLine(int x1, int y1, int x2, int y2) {
+        int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+        int dy = y2 > y1 ? y2 - y1 : y1 - y2;
+        bool swapxy = dy > dx;
+        if (swapxy) {
+            swapValues(dx, dy);
+            swapValues(x1, y1);
+            swapValues(x2, y2);
+        }
+        if (x1 > x2) {
+            swapValues(x1, x2);
+            swapValues(y1, y2);
+        }
+        int err = dx >> 1;
+        int ystep = y2 > y1 ? 1 : -1;
+        int y = y1;
+        for (int x = x1; x <= x2; x++) {
+            if (swapxy) drawPixel(y, x); else drawPixel(x, y);
+            err -= dy;
+            if (err < 0) {
+                y += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    constexpr void drawDisc(int x0, int y0, int rad) {
+        int f = 1 - rad;
+        int ddF_x = 1;
+        int ddF_y = -2 * rad;
+        int x = 0;
+        int y = rad;
+        discSection(x, y, x0, y0);
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            discSection(x, y, x0, y0);
+        }
+    }
+
+    // U8g2's polygon fill (u8g2_polygon.c) for three points, so the baked
+    // tree matches what u8g2.drawTriangle() puts on the panel: a pointed top
+    // starts one line down, and each line fills [left, right). Clipping is
+    // left to drawPixel.
+    constexpr void drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+        const int xs[3] = {x0, x1, x2};
+        const int ys[3] = {y0, y1, y2};
+
+        int minY = ys[0];
+        int maxY = ys[0];
+        int top = 0;
+        for (int i = 1; i < 3; i++) {
+            if (maxY < ys[i]) maxY = ys[i];
+            if (minY > ys[i]) {
+                top = i;
+                minY = ys[i];
+            }
+        }
+        int lines = maxY - minY;
+        if (lines == 0) return;
+
+        // The right edge walks the points forwards, the left one backwards,
+        // both past any other point on the top line
+        PolygonEdge edges[2] = {};
+        edges[0].index = top;
+        edges[1].index = top;
+        for (int e = 0; e < 2; e++) {
+            for (;;) {
+                int i = nextPoint(edges[e].index, e);
+                if (ys[i] != minY) break;
+                edges[e].index = i;
+            }
+        }
+        const bool pointedTop = xs[edges[0].index] == xs[edges[1].index];
+
+        for (int e = 0; e < 2; e++) startEdge(edges[e], e, xs, ys);
+        if (pointedTop) {
+            edges[0].next();
+            edges[1].next();
+        }
+        do {
+            int left = edges[0].x;
+            int right = edges[1].x;
+            if (left > right) swapValues(left, right);
+            drawHLine(left, edges[1].y, right - left);
+            for (int e = 0; e < 2; e++) {
+                while (!edges[e].next()) startEdge(edges[e], e, xs, ys);
+            }
+        } while (--lines > 0);
+    }
+    constexpr Sprite sprite() const {
+        return {W, H, (uint8_t)anchorX, (uint8_t)anchorY, bits, mask};
+    }
+
+private:
+    // One side of U8g2's polygon fill: Bresenham from a point to the next,
+    // one step per scanline
+    struct PolygonEdge {
+        int direction, height, step, errorStep;
+        int x, y, maxY, error;
+        int index;
+
+        constexpr void start(int xa, int ya, int xb, int yb) {
+            int dx = xb - xa;
+            height = yb - ya;
+            maxY = yb;
+            x = xa;
+            y = ya;
+            direction = dx >= 0 ? 1 : -1;
+            error = dx >= 0 ? 0 : 1 - height;
+            // Edges that don't go down are never stepped
+            step = height > 0 ? dx / height : 0;
+            errorStep = height > 0 ? (dx >= 0 ? dx : -dx) % height : 0;
+        }
+
+        constexpr bool next() {
+            if (y >= maxY) return false;
+            x += step;
+            error += errorStep;
+            if (error > 0) {
+                x += direction;
+                error -= height;
+            }
+            y++;
+            return true;
+        }
+    };
+
+    static constexpr int nextPoint(int i, int edge) {
+        return edge ? (i + 1) % 3 : (i + 2) % 3;
+    }
+
+    static constexpr void startEdge(PolygonEdge &edge, int side, const int *xs, const int *ys) {
+        int from = edge.index;
+        edge.index = nextPoint(from, side);
+        edge.start(xs[from], ys[from], xs[edge.index], ys[edge.index]);
+    }
+
+    static constexpr void swapValues(int &a, int &b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+
+    constexpr void discSection(int x, int y, int x0, int y0) {
+        drawVLine(x0 + x, y0 - y, 2 * y + 1);
+        drawVLine(x0 - x, y0 - y, 2 * y + 1);
+        drawVLine(x0 + y, y0 - x, 2 * x + 1);
+        drawVLine(x0 - y, y0 - x, 2 * x + 1);
+    }
+};
+
+// Baked sprites. Canvas sizes are the shape's bounding box, the anchor is
+// the shape's origin within it.
+constexpr SpriteCanvas<25, 27> bakeTree() {
+    SpriteCanvas<25, 27> canvas(12, 22);
+    drawTreeShape(canvas, 0, 0);
+    return canvas;
+}
+
+constexpr SpriteCanvas<9, 18> bakeSnowman() {
+    SpriteCanvas<9, 18> canvas(4, 13);
+    drawSnowmanShape(canvas, 0, 0);
+    return canvas;
+}
+
+template <int W, int H>
+constexpr SpriteCanvas<9, 6> bakePresent() {
+    SpriteCanvas<9, 6> canvas(4, 6);
+    drawPresentShape(canvas, 0, 0, W, H);
+    return canvas;
+}
+
+constexpr SpriteCanvas<7, 7> bakeMoon() {
+    SpriteCanvas<7, 7> canvas(3, 3);
+    drawMoonShape(canvas, 0, 0);
+    return canvas;
+}
+
+inline constexpr auto TREE_CANVAS = bakeTree();
+inline constexpr auto SNOWMAN_CANVAS = bakeSnowman();
+inline constexpr auto PRESENT_LARGE_CANVAS = bakePresent<6, 4>();
+inline constexpr auto PRESENT_MEDIUM_CANVAS = bakePresent<4, 3>();
+inline constexpr auto PRESENT_SMALL_CANVAS = bakePresent<3, 2>();
+inline constexpr auto MOON_CANVAS = bakeMoon();
+
+inline constexpr Sprite SPRITE_TREE = TREE_CANVAS.sprite();
+inline constexpr Sprite SPRITE_SNOWMAN = SNOWMAN_CANVAS.sprite();
+inline constexpr Sprite SPRITE_PRESENT_LARGE = PRESENT_LARGE_CANVAS.sprite();
+inline constexpr Sprite SPRITE_PRESENT_MEDIUM = PRESENT_MEDIUM_CANVAS.sprite();
+inline constexpr Sprite SPRITE_PRESENT_SMALL = PRESENT_SMALL_CANVAS.sprite();
+inline constexpr Sprite SPRITE_MOON = MOON_CANVAS.sprite();
+
+// Blit a sprite with its anchor at (x, y), clipped to the panel's buffer
+template <typename PanelT>
+inline void blitSprite(U8G2 &display, const Sprite &sprite, int x, int y) {
+    uint8_t *buffer = display.getBufferPtr();
+    constexpr int stride = PanelT::BUFFER_WIDTH;
+    constexpr int pages = PanelT::BUFFER_TILE_HEIGHT;
+    const int spritePages = (sprite.height + 7) / 8;
+
+    const int left = x - sprite.anchorX;
+    const int top = y - sprite.anchorY;
+    const int shift = top & 7;
+    const int firstPage = top >> 3;
+
+    int c0 = left < 0 ? -left : 0;
+    int c1 = left + sprite.width > stride ? stride - left : sprite.width;
+
+    for (int p = 0; p < spritePages; p++) {
+        const uint8_t *bits = sprite.bits + p * sprite.width;
+        const uint8_t *mask = sprite.mask + p * sprite.width;
+        const int page = firstPage + p;
+        const bool lowVisible = page >= 0 && page < pages;
+        const bool highVisible = shift && page + 1 >= 0 && page + 1 < pages;
+
+        for (int c = c0; c < c1; c++) {
+            const uint8_t m = mask[c];
+            if (!m) continue;
+            const uint8_t b = bits[c];
+            const int column = left + c;
+            if (lowVisible) {
+                uint8_t &dst = buffer[page * stride + column];
+                uint8_t ml = m << shift;
+                dst = (dst & ~ml) | ((b << shift) & ml);
+            }
+            if (highVisible) {
+                uint8_t &dst = buffer[(page + 1) * stride + column];
+                uint8_t mh = m >> (8 - shift);
+                dst = (dst & ~mh) | ((b >> (8 - shift)) & mh);
+            }
+        }
+    }
+}
+
+#endif // SPRITE_ATLAS_H
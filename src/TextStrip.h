@@ -0,0 +1,79 @@
+#ifndef TEXT_STRIP_H
+#define TEXT_STRIP_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "SpriteAtlas.h"
+
+// Pre-rendered text strips
+//
+// drawStr() decodes every glyph from U8g2's compressed font format on each
+// call. A TextStrip rasterizes its string once, when it is set, through the
+// same U8g2 font code into a one page strip of bits plus mask (the sprite
+// layout of SpriteAtlas.h), and drawing it is a sprite blit of the columns
+// that land in the buffer. The mask is whatever the font code wrote at all,
+// taken from a second pass over a filled page, so the blit reproduces
+// drawStr() in the current font mode pixel for pixel.
+//
+// set() borrows the top two pages of the U8g2 buffer and puts them back, so
+// the text can change at any time; it leaves the font selected. Fonts have
+// to fit the 8 rows from 6 above the baseline to 1 below (4x6, 5x7, ...),
+// text wider than COLUMNS is cut off. Each ticker owns its strip, any
+// number of them can run side by side.
+template <typename PanelT, int COLUMNS>
+class TextStrip {
+private:
+    static_assert(COLUMNS <= 255, "Sprite widths are 8 bit");
+    static constexpr int stride = PanelT::BUFFER_WIDTH;
+    static constexpr int ASCENT = 6;    // Baseline row in the strip
+
+    uint8_t bits[COLUMNS];
+    uint8_t mask[COLUMNS];
+    uint8_t width;
+
+    // Draw the text over page 0 filled with fill, one buffer width at a time
+    void rasterize(U8G2 &display, const char *text, uint8_t fill, uint8_t *out) {
+        uint8_t *page = display.getBufferPtr();
+        for (int offset = 0; offset < width; offset += stride) {
+            memset(page, fill, stride);
+            display.drawStr(-offset, ASCENT, text);
+            memcpy(out + offset, page, min(stride, width - offset));
+        }
+    }
+
+public:
+    TextStrip() : width(0) {
+        memset(bits, 0, sizeof(bits));
+        memset(mask, 0, sizeof(mask));
+    }
+
+    // Rasterize text in font, false if it had to be cut to COLUMNS
+    bool set(U8G2 &display, const uint8_t *font, const char *text) {
+        uint8_t *buffer = display.getBufferPtr();
+        uint8_t saved[2 * stride];
+        memcpy(saved, buffer, sizeof(saved));
+
+        display.setFont(font);
+        const int textWidth = display.getStrWidth(text);
+        width = min(textWidth, COLUMNS);
+        rasterize(display, text, 0x00, bits);
+        rasterize(display, text, 0xFF, mask);
+        for (int c = 0; c < width; c++) mask[c] = ~mask[c] | bits[c];
+
+        memcpy(buffer, saved, sizeof(saved));
+        return textWidth <= COLUMNS;
+    }
+
+    int getWidth() const { return width; }
+
+    Sprite sprite() const {
+        return {width, 8, 0, ASCENT, bits, mask};
+    }
+
+    // Same pixels as drawStr(x, baseline, text), clipped to the buffer
+    void draw(U8G2 &display, int x, int baseline) const {
+        blitSprite<PanelT>(display, sprite(), x, baseline);
+    }
+};
+
+#endif // TEXT_STRIP_H
@@ -0,0 +1,88 @@
+#ifndef TRIG_TABLES_H
+#define TRIG_TABLES_H
+
+#include <Arduino.h>
+#include "FixedPoint.h"
+
+// Lookup table trigonometry
+//
+// Angles are binary: ANGLE_STEPS per full turn, so wrapping is a mask and
+// the quadrant is two bits. One quarter wave of sine is generated at
+// compile time (Q2.14, 1.0 = 16384) and lives in flash; the other three
+// quadrants and cosine are reflections of it. No libm or soft-float calls
+// at runtime.
+typedef uint16_t Angle;
+
+constexpr int ANGLE_BITS = 10;
+constexpr Angle ANGLE_STEPS = 1 << ANGLE_BITS;       // 1024 per turn
+constexpr Angle ANGLE_MASK = ANGLE_STEPS - 1;
+constexpr Angle QUARTER_TURN = ANGLE_STEPS / 4;
+constexpr Angle HALF_TURN = ANGLE_STEPS / 2;
+constexpr int TRIG_ONE_BITS = 14;
+constexpr int16_t TRIG_ONE = 1 << TRIG_ONE_BITS;
+
+constexpr Angle degreesToAngle(int degrees) {
+    return (Angle)(((long)degrees * ANGLE_STEPS + (degrees >= 0 ? 180 : -180)) / 360) & ANGLE_MASK;
+}
+
+// Table generation, only evaluated by the compiler
+constexpr double TRIG_PI = 3.14159265358979323846;
+
+constexpr double taylorSine(double x) {
+    double term = x, sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+struct QuarterSineTable {
+    int16_t values[QUARTER_TURN + 1];
+};
+
+constexpr QuarterSineTable buildQuarterSineTable() {
+    QuarterSineTable table = {};
+    for (int i = 0; i <= QUARTER_TURN; i++) {
+        double value = taylorSine(i * (TRIG_PI / 2) / QUARTER_TURN) * TRIG_ONE;
+        table.values[i] = (int16_t)(value + 0.5);
+    }
+    return table;
+}
+
+inline constexpr QuarterSineTable QUARTER_SINE PROGMEM = buildQuarterSineTable();
+
+static_assert(QUARTER_SINE.values[0] == 0, "sin(0) must be exact");
+static_assert(QUARTER_SINE.values[QUARTER_TURN] == TRIG_ONE, "sin(90) must be exact");
+
+// sin/cos in Q2.14
+inline int16_t sinQ14(Angle angle) {
+    angle &= ANGLE_MASK;
+    Angle index = angle & (QUARTER_TURN - 1);
+    if (angle & QUARTER_TURN) index = QUARTER_TURN - index;
+    int16_t value = QUARTER_SINE.values[index];
+    return (angle & HALF_TURN) ? -value : value;
+}
+
+inline int16_t cosQ14(Angle angle) {
+    return sinQ14(angle + QUARTER_TURN);
+}
+
+inline Q16_16 sinFixed(Angle angle) {
+    return Q16_16::fromRaw((int32_t)sinQ14(angle) << (16 - TRIG_ONE_BITS));
+}
+
+inline Q16_16 cosFixed(Angle angle) {
+    return Q16_16::fromRaw((int32_t)cosQ14(angle) << (16 - TRIG_ONE_BITS));
+}
+
+// Pixel offset of a point at radius along angle, rounded to nearest
+inline int polarX(int radius, Angle angle) {
+    return ((int32_t)radius * cosQ14(angle) + (TRIG_ONE >> 1)) >> TRIG_ONE_BITS;
+}
+
+inline int polarY(int radius, Angle angle) {
+    return ((int32_t)radius * sinQ14(angle) + (TRIG_ONE >> 1)) >> TRIG_ONE_BITS;
+}
+
+#endif // TRIG_TABLES_H
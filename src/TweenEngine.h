@@ -0,0 +1,203 @@
+#ifndef TWEEN_ENGINE_H
+#define TWEEN_ENGINE_H
+
+#include <Arduino.h>
+#include "FixedPoint.h"
+#include "TrigTables.h"
+
+// Time-based tweens
+//
+// A tween takes a Q16.16 value from `from` to `to` over durationMs along an
+// easing curve, once, looping or back and forth. The value is worked out
+// from the time since it started rather than stepped per frame, so a late
+// frame shows it where it belongs by then instead of slowing it down.
+//
+// Easing curves are tables of EASING_STEPS + 1 points (Q1.15, 1.0 = 32768)
+// generated at compile time and interpolated linearly; quad, cubic and sine
+// ease in and out, bounce eases out. No floats at runtime.
+//
+// TweenPool keeps its tweens as structure-of-arrays with a live bitmask like
+// the particle pool (AnimationManager.h): start() hands out a slot, update()
+// evaluates every running tween in one pass per frame, get() reads the
+// result. A finished one-shot tween keeps its final value until its slot is
+// started again or released.
+enum Easing : uint8_t {
+    EASE_LINEAR,
+    EASE_QUAD,
+    EASE_CUBIC,
+    EASE_SINE,
+    EASE_BOUNCE,
+    EASING_COUNT
+};
+
+enum TweenMode : uint8_t {
+    TWEEN_ONCE,         // Stop at `to`
+    TWEEN_LOOP,         // Jump back to `from` and go again
+    TWEEN_PING_PONG     // Back to `from` over the same duration, and again
+};
+
+constexpr int EASING_STEP_BITS = 6;
+constexpr int EASING_STEPS = 1 << EASING_STEP_BITS;  // Segments per curve
+constexpr int EASE_ONE_BITS = 15;
+constexpr uint32_t EASE_ONE = 1UL << EASE_ONE_BITS;
+constexpr uint32_t PROGRESS_ONE = 1UL << 16;         // Q0.16 progress, 1.0 = done
+
+// Table generation, only evaluated by the compiler
+constexpr double easeCurve(Easing easing, double t) {
+    switch (easing) {
+        case EASE_QUAD:
+            return t < 0.5 ? 2 * t * t : 1 - 2 * (1 - t) * (1 - t);
+        case EASE_CUBIC:
+            return t < 0.5 ? 4 * t * t * t : 1 - 4 * (1 - t) * (1 - t) * (1 - t);
+        case EASE_SINE: {
+            double s = taylorSine(t * TRIG_PI / 2);  // (1 - cos(pi t)) / 2
+            return s * s;
+        }
+        case EASE_BOUNCE: {
+            constexpr double n = 7.5625, d = 2.75;
+            if (t < 1 / d) return n * t * t;
+            if (t < 2 / d) return n * (t - 1.5 / d) * (t - 1.5 / d) + 0.75;
+            if (t < 2.5 / d) return n * (t - 2.25 / d) * (t - 2.25 / d) + 0.9375;
+            return n * (t - 2.625 / d) * (t - 2.625 / d) + 0.984375;
+        }
+        default:
+            return t;
+    }
+}
+
+struct EasingTables {
+    uint16_t values[EASING_COUNT][EASING_STEPS + 1];
+};
+
+constexpr EasingTables buildEasingTables() {
+    EasingTables tables = {};
+    for (int e = 0; e < EASING_COUNT; e++) {
+        for (int i = 0; i <= EASING_STEPS; i++) {
+            double value = easeCurve((Easing)e, (double)i / EASING_STEPS) * EASE_ONE;
+            tables.values[e][i] = (uint16_t)(value + 0.5);
+        }
+    }
+    return tables;
+}
+
+inline constexpr EasingTables EASING_TABLES PROGMEM = buildEasingTables();
+
+static_assert(EASING_TABLES.values[EASE_SINE][0] == 0, "Curves must start at 0");
+static_assert(EASING_TABLES.values[EASE_BOUNCE][EASING_STEPS] == EASE_ONE, "Curves must end at 1");
+
+// Eased Q0.16 progress, 0..PROGRESS_ONE
+inline uint32_t ease(Easing easing, uint32_t progress) {
+    constexpr int fractionBits = 16 - EASING_STEP_BITS;
+    const uint16_t *curve = EASING_TABLES.values[easing];
+    const uint32_t index = progress >> fractionBits;
+    if (index >= EASING_STEPS) return (uint32_t)curve[EASING_STEPS] << (16 - EASE_ONE_BITS);
+    const int32_t a = curve[index], b = curve[index + 1];
+    const int32_t fraction = progress & ((1 << fractionBits) - 1);
+    return (uint32_t)(a + (((b - a) * fraction) >> fractionBits)) << (16 - EASE_ONE_BITS);
+}
+
+template <uint8_t CAPACITY>
+class TweenPool {
+public:
+    typedef int8_t Handle;  // Slot, -1 when none
+    static_assert(CAPACITY <= 32, "One mask word of slots");
+
+private:
+    static constexpr uint32_t ALL_SLOTS = (uint32_t)((1ULL << CAPACITY) - 1);
+
+    Q16_16 from[CAPACITY], delta[CAPACITY], value[CAPACITY];
+    unsigned long startMs[CAPACITY];
+    uint16_t durationMs[CAPACITY];
+    Easing easing[CAPACITY];
+    TweenMode mode[CAPACITY];
+
+    uint32_t usedMask;      // Slots handed out
+    uint32_t runningMask;   // Slots still moving
+
+    Q16_16 evaluate(uint8_t slot, unsigned long nowMs) const {
+        const uint32_t duration = durationMs[slot];
+        uint32_t elapsed = nowMs - startMs[slot];
+        switch (mode[slot]) {
+            case TWEEN_LOOP:
+                elapsed %= duration;
+                break;
+            case TWEEN_PING_PONG:
+                elapsed %= 2 * duration;
+                if (elapsed > duration) elapsed = 2 * duration - elapsed;
+                break;
+            default:
+                if (elapsed > duration) elapsed = duration;
+                break;
+        }
+        const uint32_t eased = ease(easing[slot], (elapsed << 16) / duration);
+        return from[slot] + Q16_16::fromRaw((int32_t)(((int64_t)delta[slot].getRaw() * eased) >> 16));
+    }
+
+public:
+    TweenPool() : usedMask(0), runningMask(0) {}
+
+    // A free slot running from..to, or -1 when the pool is full
+    Handle start(Q16_16 initial, Q16_16 to, uint16_t duration, Easing curve, TweenMode tweenMode,
+                 unsigned long nowMs) {
+        const uint32_t free = ~usedMask & ALL_SLOTS;
+        if (!free) return -1;
+        const Handle handle = __builtin_ctz(free);
+        usedMask |= 1UL << handle;
+        restart(handle, initial, to, duration, curve, tweenMode, nowMs);
+        return handle;
+    }
+
+    // Reuse a slot for a new tween
+    void restart(Handle handle, Q16_16 initial, Q16_16 to, uint16_t duration, Easing curve,
+                 TweenMode tweenMode, unsigned long nowMs) {
+        from[handle] = value[handle] = initial;
+        delta[handle] = to - initial;
+        startMs[handle] = nowMs;
+        durationMs[handle] = max(duration, (uint16_t)1);
+        easing[handle] = curve;
+        mode[handle] = tweenMode;
+        runningMask |= 1UL << handle;
+    }
+
+    void release(Handle handle) {
+        usedMask &= ~(1UL << handle);
+        runningMask &= ~(1UL << handle);
+    }
+
+    // Evaluate every running tween at nowMs
+    void update(unsigned long nowMs) {
+        uint32_t bits = runningMask;
+        while (bits) {
+            const uint8_t slot = __builtin_ctz(bits);
+            bits &= bits - 1;
+            value[slot] = evaluate(slot, nowMs);
+            if (mode[slot] == TWEEN_ONCE && nowMs - startMs[slot] >= durationMs[slot]) {
+                runningMask &= ~(1UL << slot);
+            }
+        }
+    }
+
+    Q16_16 get(Handle handle) const { return value[handle]; }
+    int getInt(Handle handle) const { return value[handle].toInt(); }
+    bool isRunning(Handle handle) const { return runningMask & (1UL << handle); }
+
+    // First of the next maxSteps stepMs steps after nowMs at which the
+    // whole-pixel value differs from the one at nowMs, for the animation
+    // scheduler. nowMs + maxSteps * stepMs if none does.
+    unsigned long nextChange(Handle handle, unsigned long nowMs, unsigned long stepMs,
+                             uint8_t maxSteps) const {
+        if (!isRunning(handle)) return nowMs + maxSteps * stepMs;
+        const int current = evaluate(handle, nowMs).toInt();
+        unsigned long when = nowMs;
+        for (uint8_t step = 0; step < maxSteps; step++) {
+            when += stepMs;
+            if (evaluate(handle, when).toInt() != current) break;
+        }
+        return when;
+    }
+
+    uint8_t getActiveCount() const { return __builtin_popcount(usedMask); }
+    static constexpr uint8_t getCapacity() { return CAPACITY; }
+};
+
+#endif // TWEEN_ENGINE_H
@@ -0,0 +1,156 @@
+#ifndef ZONE_PROFILER_H
+#define ZONE_PROFILER_H
+
+#include <Arduino.h>
+
+// Zone profiler
+//
+// Scoped timers feed fixed-bucket log-scale histograms, one per zone per
+// scene. Buckets split each power of two of microseconds in half (0-3 us
+// exact, then 4-5, 6-7, 8-11, 12-15, ...) up to 64 ms, so percentiles are
+// within 25% and recording is a count-leading-zeros and an increment: cheap
+// enough to leave on. Sums are integer, so the mean does not drift the
+// way a float running average does after a few million frames.
+//
+// Histograms are handed out from a pool of SLOTS on a zone's first sample in
+// a scene, so only the zones a scene actually times take RAM. Bucket counts
+// are 16-bit; when one fills, all of that histogram's buckets are halved,
+// which keeps the percentiles while n, mean and max stay exact.
+template <uint8_t ZONES, uint8_t SCENES, uint8_t SLOTS = ZONES * SCENES>
+class ZoneProfiler {
+public:
+    static constexpr uint8_t BUCKETS = 32;
+
+    struct Histogram {
+        uint16_t counts[BUCKETS];
+        uint32_t samples;
+        uint32_t overruns;
+        uint32_t maxUs;
+        uint64_t totalUs;
+    };
+
+    // Times its own lifetime into a zone of the current scene
+    class Scope {
+    private:
+        ZoneProfiler &profiler;
+        uint8_t zone;
+        uint32_t start;
+
+    public:
+        Scope(ZoneProfiler &owner, uint8_t zoneId)
+            : profiler(owner), zone(zoneId), start(nowUs()) {}
+        ~Scope() { profiler.record(zone, nowUs() - start); }
+    };
+
+private:
+    const char *const *zoneNames;
+    uint8_t scene;
+    uint8_t slotsUsed;
+    uint32_t budgets[ZONES];
+    uint8_t slots[SCENES][ZONES];   // Pool index + 1, 0 until first sampled
+    Histogram histograms[SLOTS];
+
+    static uint8_t bucketFor(uint32_t us) {
+        if (us < 4) return us;
+        uint8_t msb = 31 - __builtin_clz(us);
+        uint8_t bucket = msb * 2 + ((us >> (msb - 1)) & 1);
+        return bucket < BUCKETS ? bucket : BUCKETS - 1;
+    }
+
+    // Largest value that lands in a bucket
+    static uint32_t bucketLimit(uint8_t bucket) {
+        if (bucket < 4) return bucket;
+        uint8_t msb = bucket / 2;
+        uint32_t half = 1UL << (msb - 1);
+        return (1UL << msb) + (bucket & 1) * half + half - 1;
+    }
+
+public:
+    static uint32_t nowUs() {
+        #ifdef ESP32
+        return micros();
+        #else
+        return HostClock::nowNs() / 1000;  // Real time, the simulated clock only moves in delay()
+        #endif
+    }
+
+    ZoneProfiler(const char *const *names) : zoneNames(names), scene(0) {
+        memset(budgets, 0, sizeof(budgets));
+        reset();
+    }
+
+    // Scene the following samples belong to
+    void setScene(uint8_t sceneId) { scene = sceneId < SCENES ? sceneId : SCENES - 1; }
+    uint8_t getScene() const { return scene; }
+
+    // Samples above budgetUs count as overruns, 0 disables
+    void setBudget(uint8_t zone, uint32_t budgetUs) { budgets[zone] = budgetUs; }
+
+    void record(uint8_t zone, uint32_t us) {
+        uint8_t &slot = slots[scene][zone];
+        if (slot == 0) {
+            if (slotsUsed == SLOTS) return;  // Pool sized too small
+            slot = ++slotsUsed;
+        }
+        Histogram &h = histograms[slot - 1];
+        uint8_t bucket = bucketFor(us);
+        if (h.counts[bucket] == UINT16_MAX) {
+            for (uint8_t b = 0; b < BUCKETS; b++) h.counts[b] /= 2;
+        }
+        h.counts[bucket]++;
+        h.samples++;
+        h.totalUs += us;
+        if (us > h.maxUs) h.maxUs = us;
+        if (budgets[zone] && us > budgets[zone]) h.overruns++;
+    }
+
+    // Empty histogram for zones never sampled in the scene
+    const Histogram &get(uint8_t sceneId, uint8_t zone) const {
+        static const Histogram EMPTY = {};
+        uint8_t slot = slots[sceneId][zone];
+        return slot ? histograms[slot - 1] : EMPTY;
+    }
+
+    // Upper edge of the bucket holding the given percentile (never above max)
+    static uint32_t percentile(const Histogram &h, uint8_t percent) {
+        if (h.samples == 0) return 0;
+        uint32_t counted = 0;  // Below samples once buckets have been halved
+        for (uint8_t b = 0; b < BUCKETS; b++) counted += h.counts[b];
+        uint32_t rank = ((uint64_t)counted * percent + 99) / 100;
+        uint32_t seen = 0;
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            seen += h.counts[b];
+            if (seen >= rank) return min(bucketLimit(b), h.maxUs);
+        }
+        return h.maxUs;
+    }
+
+    static uint32_t mean(const Histogram &h) {
+        return h.samples ? h.totalUs / h.samples : 0;
+    }
+
+    // One line per used zone and scene:
+    // "PROF <scene> <zone> n=<samples> mean=.. p50=.. p95=.. p99=.. max=.. over=.."
+    template <typename Output, typename SceneName>
+    void dump(Output &out, SceneName sceneName) const {
+        for (uint8_t s = 0; s < SCENES; s++) {
+            for (uint8_t z = 0; z < ZONES; z++) {
+                const Histogram &h = get(s, z);
+                if (h.samples == 0) continue;
+                out.printf("PROF %s %s n=%lu mean=%lu p50=%lu p95=%lu p99=%lu max=%lu over=%lu\n",
+                           sceneName(s), zoneNames[z], (unsigned long)h.samples,
+                           (unsigned long)mean(h), (unsigned long)percentile(h, 50),
+                           (unsigned long)percentile(h, 95), (unsigned long)percentile(h, 99),
+                           (unsigned long)h.maxUs, (unsigned long)h.overruns);
+            }
+        }
+    }
+
+    void reset() {
+        memset(slots, 0, sizeof(slots));
+        memset(histograms, 0, sizeof(histograms));
+        slotsUsed = 0;
+    }
+};
+
+#endif // ZONE_PROFILER_H
@@ -3,19 +3,9 @@
 
 #include <Arduino.h>
 #include <U8g2lib.h>
+#include "config.h"
 
-// Screen configuration
-extern const int SCREEN_WIDTH;
-extern const int SCREEN_HEIGHT;
-extern const int FRAME_WIDTH;
-extern const int FRAME_HEIGHT;
-extern const int X_OFFSET;
-extern const int Y_OFFSET;
-
-// Animation timing
-extern const unsigned long SCENE_DURATION;
-extern const unsigned long DAY_NIGHT_DURATION;
-extern const unsigned long WEATHER_CHANGE_DURATION;
+// Screen geometry and timing are constexpr in config.h and Panel.h
 
 // Weather system
 enum Weather { SNOW, RAIN, CLEAR };
@@ -36,14 +26,8 @@ struct AnimationState {
     bool direction;
 };
 
-// Scene management
-enum Scene {
-    SCENE_CHRISTMAS_TREE = 0,
-    SCENE_SANTA_SLEIGH,
-    SCENE_FIREPLACE,
-    SCENE_WEATHER_DISPLAY,
-    SCENE_COUNT
-};
+// Scenes are display lists registered in the SCENES table in main.cpp
+// (see SceneEngine.h), indexed 0..SCENE_COUNT-1
 
 // Function declarations
 void initDisplay();
@@ -63,6 +47,6 @@ void drawFrameBorder();
 // Animation helpers
 void updateParticleSystem();
 void updateAnimationTimers();
-void resetScene(Scene scene);
+void resetScene(uint8_t scene);
 
 #endif // ANIMATION_H 
\ No newline at end of file
@@ -2,29 +2,38 @@
 #define CONFIG_H
 
 #include <Arduino.h>
+#include "Panel.h"
 
 // Memory optimization - store strings in PROGMEM
 const char PROGMEM SCROLL_TEXT[] = "MERRY XMAS!";
 const char PROGMEM STARTUP_MSG[] = "Christmas Demo initialized";
 
-// Display configuration
-constexpr int SCREEN_WIDTH = 132;  // Effective usable width for this specific 0.42" OLED
-constexpr int SCREEN_HEIGHT = 64;
-
-constexpr int FRAME_WIDTH = 72;
-constexpr int FRAME_HEIGHT = 40;
-constexpr int X_OFFSET = (SCREEN_WIDTH - FRAME_WIDTH) / 2;  // Now calculates to 30
-constexpr int Y_OFFSET = (SCREEN_HEIGHT - FRAME_HEIGHT) / 2;
+// Display configuration, the panel variant is chosen in Panel.h
+constexpr int FRAME_WIDTH = Panel::WINDOW_WIDTH;
+constexpr int FRAME_HEIGHT = Panel::WINDOW_HEIGHT;
+constexpr int X_OFFSET = Panel::X_OFFSET;   // Window position in the buffer
+constexpr int Y_OFFSET = Panel::Y_OFFSET;
 
 // Animation timing (using constexpr for compile-time constants)
 constexpr unsigned long SCENE_DURATION = 5000;          // 5 seconds
+constexpr uint16_t TRANSITION_MS = 600;                 // Wipe/dissolve/crossfade into the next scene
 constexpr unsigned long DAY_NIGHT_DURATION = 10000;     // 10 seconds
 constexpr unsigned long WEATHER_CHANGE_DURATION = 10000; // 10 seconds
 constexpr unsigned long ANIMATION_FRAME_DELAY = 50;     // 50ms = 20 FPS
-constexpr unsigned long STAR_ANIMATION_SPEED = 50;      // Star twinkle speed
-constexpr unsigned long ARM_ANIMATION_SPEED = 200;      // Snowman arm speed
+constexpr uint8_t DEFAULT_TARGET_FPS = 1000 / ANIMATION_FRAME_DELAY;
+constexpr uint8_t MAX_TARGET_FPS = 60;                  // Upper limit for "fps <n>" over serial
+constexpr uint16_t STAR_PULSE_MS = 300;                 // Star from dark to full brightness, and back
+constexpr uint16_t ARM_WAVE_MS = 750;                   // Snowman arms from low to high, and back
+constexpr uint16_t SANTA_FLIGHT_MS = 5000;              // Santa across the window, one scene long
 constexpr unsigned long TEXT_SCROLL_SPEED = 100;        // Text scroll speed
+constexpr uint16_t HARDWARE_SCROLL_FRAMES = 5;          // Panel refreshes per banner pixel: 2-5, 25, 64, 128, 256
 constexpr unsigned long FLAME_ANIMATION_SPEED = 100;    // Flame flicker speed
+constexpr unsigned long TWINKLE_PERIOD = 500;           // Tree lights alternate every half second
+constexpr uint8_t ANIMATION_TIMER_SLOTS = 8;            // Timers the animation scheduler tracks
+constexpr uint8_t TWEEN_SLOTS = 8;                      // Tween pool size, at most 32
+constexpr unsigned long RENDER_SKIP_MAX_MS = 250;       // Longest sleep between rendered frames
+constexpr unsigned long LIGHT_SLEEP_MIN_US = 3000;      // Shorter sleeps stay in delay()
+constexpr unsigned long LIGHT_SLEEP_WAKE_US = 1000;     // Wake this early, delay() the rest
 
 // Particle system configuration
 constexpr int MAX_PARTICLES = 32;
@@ -32,6 +41,8 @@ constexpr int MIN_PARTICLE_SPEED = 1;
 constexpr int MAX_PARTICLE_SPEED = 3;
 
 // Drawing configuration
+constexpr size_t BANNER_TEXT_MAX = 48;             // Characters, "banner <text>" over serial
+constexpr int BANNER_STRIP_COLUMNS = 192;          // Pre-rendered banner width, 4x6 font: 48 glyphs
 constexpr int STAR_MAX_BRIGHTNESS = 3;
 constexpr int FLAME_MAX_HEIGHT = 4;
 constexpr int SANTA_WIDTH = 12;
@@ -40,15 +51,53 @@ constexpr int SANTA_HEIGHT = 6;
 // I2C Configuration
 constexpr uint8_t I2C_SDA_PIN = 6;
 constexpr uint8_t I2C_SCL_PIN = 5;
-constexpr uint32_t I2C_FREQUENCY = 400000;  // 400kHz
+constexpr uint32_t I2C_FREQUENCY = 400000;   // Fast-mode, capped by Panel::MAX_BUS_CLOCK
+constexpr uint32_t I2C_BUS_CLOCK = I2C_FREQUENCY < Panel::MAX_BUS_CLOCK ? I2C_FREQUENCY : Panel::MAX_BUS_CLOCK;
+constexpr size_t I2C_BUFFER_BYTES = 132;     // Wire buffer: a 128 column page plus control byte
+
+// Display transfer configuration
+constexpr size_t FRAME_BUFFER_BYTES = Panel::BUFFER_BYTES;  // U8g2 full buffer, 1024 or 360
+constexpr uint32_t TRANSFER_TASK_STACK = 4096;
+constexpr uint8_t TRANSFER_TASK_PRIORITY = 2;         // Above loop() so sends start at once
+
+// Background layer cache
+constexpr uint8_t BACKGROUND_CACHE_SLOTS = 2;                    // Current and next scene
+constexpr unsigned long BACKGROUND_PREFETCH_LEAD = 1000;         // Prefetch in last 1s of a scene
+constexpr long BACKGROUND_PREFETCH_MIN_IDLE_US = 5000;           // Only with this much slack left
 
 // Serial configuration
 constexpr uint32_t SERIAL_BAUD_RATE = 115200;
+constexpr size_t LOG_RING_BYTES = 2048;   // Queued log output, power of two
+constexpr size_t LOG_LINE_MAX = 160;      // Longest single log record
+constexpr size_t SERIAL_DRAIN_CHUNK = 64; // Bytes written between slack checks when draining
+constexpr uint16_t MIRROR_KEYFRAME_INTERVAL = 50;  // Frames between mirror keyframes
+
+// Logging, both can be set from build_flags (e.g. -DLOG_LEVEL=3 -DLOG_TOKENIZED=1)
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 2       // DEBUG_INFO, higher levels are compiled out
+#endif
+#ifndef LOG_TOKENIZED
+#define LOG_TOKENIZED 0   // 1: send format tokens, decode with tools/log_decode.py
+#endif
 
 // Feature flags
 constexpr bool ENABLE_SERIAL_DEBUG = true;
 constexpr bool ENABLE_STAR_ANIMATION = true;
 constexpr bool ENABLE_WEATHER_EFFECTS = true;
 constexpr bool ENABLE_DAY_NIGHT_CYCLE = true;
+constexpr bool ENABLE_DIRTY_TILE_TRANSFER = true;  // Send only changed tiles
+constexpr bool ENABLE_SPRITE_ATLAS = true;         // Blit pre-baked static shapes
+constexpr bool ENABLE_BACKGROUND_CACHE = true;     // Restore cached static layers
+constexpr bool USE_FIXED_POINT_MATH = true;        // Q16.16 particles/tweens, no soft-float
+constexpr bool ENABLE_PIXEL_KERNELS = true;        // Plot particles straight into the buffer
+constexpr bool ENABLE_TRANSFER_PIPELINE = true;    // Send on a task while the next frame renders
+constexpr bool ENABLE_FRAME_MIRROR = false;        // Stream the window over serial from boot
+constexpr bool ENABLE_I2C_COALESCING = true;       // One transaction per tile run, see I2cTransport.h
+constexpr bool ENABLE_HARDWARE_SCROLL = false;     // Banner scrolled by the SSD1306, see BannerScroll.h
+constexpr bool ENABLE_TEXT_STRIP = true;           // Blit the banner from a pre-rendered strip
+constexpr bool ENABLE_RENDER_SKIP = true;          // Sleep through frames where nothing changes
+constexpr bool ENABLE_FRAME_HASH = true;           // Don't send frames identical to the last one
+constexpr bool ENABLE_LIGHT_SLEEP = false;         // Light sleep in between, drops the USB serial port
+constexpr bool ENABLE_SCENE_TRANSITIONS = true;    // Blend scene changes instead of cutting
 
 #endif // CONFIG_H 
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <Arduino.h>
+#include <chrono>
+
+HostSerial Serial;
+
+static uint64_t simulatedMicros = 0;
+static uint16_t analogNoise = 0;
+static uint32_t randomState = 1;
+
+void HostClock::setMicros(uint64_t us) { simulatedMicros = us; }
+void HostClock::advanceMicros(uint64_t us) { simulatedMicros += us; }
+uint64_t HostClock::getMicros() { return simulatedMicros; }
+
+uint64_t HostClock::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void HostRandom::setAnalogNoise(uint16_t value) { analogNoise = value; }
+uint16_t HostRandom::getAnalogNoise() { return analogNoise; }
+
+void HostRandom::seed(uint32_t value) {
+    randomState = value ? value : 1;
+}
+
+uint32_t HostRandom::next() {
+    // xorshift32
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+unsigned long millis() { return (unsigned long)(simulatedMicros / 1000); }
+unsigned long micros() { return (unsigned long)simulatedMicros; }
+void delay(unsigned long ms) { simulatedMicros += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { simulatedMicros += us; }
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    return HostRandom::next() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) { HostRandom::seed((uint32_t)seed + 1); }
+
+int analogRead(uint8_t pin) {
+    (void)pin;
+    return analogNoise;
+}
+
+size_t HostSerial::write(uint8_t c) {
+    if (!muted) fputc(c, stdout);
+    return 1;
+}
+
+size_t HostSerial::write(const uint8_t *data, size_t size) {
+    if (!muted) fwrite(data, 1, size, stdout);
+    return size;
+}
+
+size_t HostSerial::print(const char *text) {
+    return write((const uint8_t *)text, strlen(text));
+}
+
+size_t HostSerial::print(long value) {
+    return printf("%ld", value);
+}
+
+size_t HostSerial::println(const char *text) {
+    return print(text) + write('\n');
+}
+
+size_t HostSerial::println(long value) {
+    return print(value) + write('\n');
+}
+
+size_t HostSerial::printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = muted ? vsnprintf(nullptr, 0, format, args) : vprintf(format, args);
+    va_end(args);
+    return length > 0 ? length : 0;
+}
@@ -0,0 +1,72 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for the native environment
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <cmath>
+#include "HostHarness.h"
+
+#define PROGMEM
+#define PI 3.1415926535897932384626433832795
+
+using std::min;
+using std::max;
+using std::abs;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+int analogRead(uint8_t pin);
+
+template <typename T>
+T constrain(T value, T low, T high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// Serial port, printed to stdout unless muted
+class HostSerial {
+private:
+    bool muted;
+
+public:
+    HostSerial() : muted(false) {}
+
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    void flush() { fflush(stdout); }
+    operator bool() const { return true; }
+    int availableForWrite() const { return 256; }
+    int available() const { return 0; }
+    int read() { return -1; }
+
+    void setMuted(bool value) { muted = value; }
+    bool isMuted() const { return muted; }
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *data, size_t size);
+    size_t print(const char *text);
+    size_t print(long value);
+    size_t println(const char *text = "");
+    size_t println(long value);
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,31 @@
+#ifndef HOST_HARNESS_H
+#define HOST_HARNESS_H
+
+#include <stdint.h>
+
+// Controls for the host build shims (native environment only)
+
+// Simulated clock behind millis()/micros()/delay(). Time only moves when
+// delay() is called or the harness advances it, so runs are repeatable.
+class HostClock {
+public:
+    static void setMicros(uint64_t us);
+    static void advanceMicros(uint64_t us);
+    static uint64_t getMicros();
+
+    // Real monotonic time, for profiling on the host
+    static uint64_t nowNs();
+};
+
+// Deterministic replacement for the ESP32 hardware RNG
+class HostRandom {
+public:
+    // Value returned by analogRead(), setup() seeds random() from it
+    static void setAnalogNoise(uint16_t value);
+    static uint16_t getAnalogNoise();
+
+    static void seed(uint32_t value);
+    static uint32_t next();
+};
+
+#endif // HOST_HARNESS_H
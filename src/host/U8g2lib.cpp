@@ -0,0 +1,437 @@
+#include <U8g2lib.h>
+
+static const u8g2_cb_t rotationR0 = {0};
+const u8g2_cb_t *const U8G2_R0 = &rotationR0;
+
+// Font handles: {glyph advance, glyph height}
+const uint8_t u8g2_font_4x6_tf[] = {4, 5};
+const uint8_t u8g2_font_ncenB10_tr[] = {4, 5};
+
+// 3x5 glyphs for ' ' to 'Z', row-major, MSB is the top left pixel
+static const uint16_t hostGlyphs[] = {
+    0x0000, 0x2482, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x01c0, 0x0002, 0x0000,
+    0x7b6f, 0x2c97, 0x62a7, 0x628e, 0x5bc9, 0x798e, 0x39ef, 0x7292,
+    0x7bef, 0x7bce, 0x0410, 0x0000, 0x0000, 0x0000, 0x0000, 0x6282,
+    0x0000, 0x2bed, 0x6bae, 0x3923, 0x6b6e, 0x79a7, 0x79a4, 0x396b,
+    0x5bed, 0x7497, 0x126a, 0x5bad, 0x4927, 0x5fed, 0x5ffd, 0x2b6a,
+    0x6ba4, 0x2b7b, 0x6bad, 0x388e, 0x7492, 0x5b6f, 0x5b6a, 0x5bfd,
+    0x5aad, 0x5a92, 0x72a7,
+};
+
+// SSD1306 128x64 init sequence as sent by U8g2's noname driver: each entry
+// is a command and its argument count
+static const uint8_t ssd1306InitSequence[] = {
+    0xae, 0, 0xd5, 1, 0x80, 0xa8, 1, 0x3f, 0xd3, 1, 0x00, 0x40, 0, 0x8d, 1, 0x14,
+    0x20, 1, 0x00, 0xa1, 0, 0xc8, 0, 0xda, 1, 0x12, 0x81, 1, 0xcf, 0xd9, 1, 0xf1,
+    0xdb, 1, 0x40, 0x2e, 0, 0xa4, 0, 0xa6, 0,
+};
+
+// Replica of U8g2's u8x8_cad_ssd13xx_fast_i2c: one transaction per command
+// (with its arguments), data in 24 byte transactions
+uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    static uint8_t inTransfer = 0;
+    uint8_t *p;
+    switch (msg) {
+        case U8X8_MSG_CAD_SEND_CMD:
+            if (inTransfer) u8x8_byte_EndTransfer(u8x8);
+            u8x8_byte_StartTransfer(u8x8);
+            u8x8_byte_SendByte(u8x8, 0x00);
+            u8x8_byte_SendByte(u8x8, arg_int);
+            inTransfer = 1;
+            break;
+        case U8X8_MSG_CAD_SEND_ARG:
+            u8x8_byte_SendByte(u8x8, arg_int);
+            break;
+        case U8X8_MSG_CAD_SEND_DATA:
+            if (inTransfer) u8x8_byte_EndTransfer(u8x8);
+            p = (uint8_t *)arg_ptr;
+            while (arg_int > 0) {
+                uint8_t chunk = arg_int > 24 ? 24 : arg_int;
+                u8x8_byte_StartTransfer(u8x8);
+                u8x8_byte_SendByte(u8x8, 0x40);
+                u8x8_byte_SendBytes(u8x8, chunk, p);
+                u8x8_byte_EndTransfer(u8x8);
+                arg_int -= chunk;
+                p += chunk;
+            }
+            inTransfer = 0;
+            break;
+        case U8X8_MSG_CAD_INIT:
+            if (u8x8->i2c_address == 255) u8x8->i2c_address = 0x78;
+            return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+        case U8X8_MSG_CAD_START_TRANSFER:
+            inTransfer = 0;
+            break;
+        case U8X8_MSG_CAD_END_TRANSFER:
+            if (inTransfer) u8x8_byte_EndTransfer(u8x8);
+            inTransfer = 0;
+            break;
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+// Replica of U8g2's u8x8_byte_arduino_hw_i2c, clock set for every transaction
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    switch (msg) {
+        case U8X8_MSG_BYTE_SEND:
+            Wire.write((uint8_t *)arg_ptr, (int)arg_int);
+            break;
+        case U8X8_MSG_BYTE_INIT:
+            if (u8x8->bus_clock == 0) u8x8->bus_clock = 400000;
+            if (u8x8->pins[U8X8_PIN_I2C_CLOCK] != U8X8_PIN_NONE &&
+                u8x8->pins[U8X8_PIN_I2C_DATA] != U8X8_PIN_NONE) {
+                Wire.begin((int)u8x8->pins[U8X8_PIN_I2C_DATA], (int)u8x8->pins[U8X8_PIN_I2C_CLOCK]);
+            } else {
+                Wire.begin();
+            }
+            break;
+        case U8X8_MSG_BYTE_SET_DC:
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            Wire.setClock(u8x8->bus_clock);
+            Wire.beginTransmission(u8x8_GetI2CAddress(u8x8) >> 1);
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            Wire.endTransmission();
+            break;
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+U8G2::U8G2(uint8_t tilesWide, uint8_t tilesHigh, uint8_t xOffset, uint8_t clock, uint8_t data)
+    : tileWidth(tilesWide), tileHeight(tilesHigh), columnOffset(xOffset),
+      drawColor(1), font(u8g2_font_4x6_tf) {
+    memset(buffer, 0, sizeof(buffer));
+    memset(panel, 0, sizeof(panel));
+    resetDrawCalls();
+    u8x8.owner = this;
+    u8x8.cad_cb = u8x8_cad_ssd13xx_fast_i2c;
+    u8x8.byte_cb = u8x8_byte_arduino_hw_i2c;
+    u8x8.bus_clock = 0;
+    u8x8.i2c_address = 255;
+    u8x8.pins[U8X8_PIN_I2C_CLOCK] = clock;
+    u8x8.pins[U8X8_PIN_I2C_DATA] = data;
+}
+
+bool U8G2::begin() {
+    u8x8.cad_cb(&u8x8, U8X8_MSG_CAD_INIT, 0, nullptr);
+
+    u8x8_cad_StartTransfer(&u8x8);
+    for (size_t i = 0; i < sizeof(ssd1306InitSequence); i += 2 + ssd1306InitSequence[i + 1]) {
+        u8x8_cad_SendCmd(&u8x8, ssd1306InitSequence[i]);
+        for (uint8_t a = 0; a < ssd1306InitSequence[i + 1]; a++) {
+            u8x8_cad_SendArg(&u8x8, ssd1306InitSequence[i + 2 + a]);
+        }
+    }
+    u8x8_cad_EndTransfer(&u8x8);
+
+    clearDisplay();
+    setPowerSave(0);
+    return true;
+}
+
+void U8G2::setContrast(uint8_t value) {
+    u8x8_cad_StartTransfer(&u8x8);
+    u8x8_cad_SendCmd(&u8x8, 0x81);
+    u8x8_cad_SendArg(&u8x8, value);
+    u8x8_cad_EndTransfer(&u8x8);
+}
+
+void U8G2::setPowerSave(uint8_t isEnable) {
+    u8x8_cad_StartTransfer(&u8x8);
+    u8x8_cad_SendCmd(&u8x8, isEnable ? 0xae : 0xaf);
+    u8x8_cad_EndTransfer(&u8x8);
+}
+
+void U8G2::drawTiles(uint8_t tx, uint8_t ty, uint8_t tw, const uint8_t *tiles) {
+    const uint8_t x = tx * 8 + columnOffset;
+    u8x8_cad_StartTransfer(&u8x8);
+    u8x8_cad_SendCmd(&u8x8, 0x10 | (x >> 4));
+    u8x8_cad_SendCmd(&u8x8, x & 15);
+    u8x8_cad_SendCmd(&u8x8, 0xb0 | ty);
+    u8x8_cad_SendData(&u8x8, tw * 8, (uint8_t *)tiles);
+    u8x8_cad_EndTransfer(&u8x8);
+    memcpy(panel + (ty * tileWidth + tx) * 8, tiles, tw * 8);
+}
+
+uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr) {
+    U8G2 *display = u8x8->owner;
+    if (x >= display->tileWidth || y >= display->tileHeight) return 0;
+    if (x + cnt > display->tileWidth) cnt = display->tileWidth - x;
+    display->drawTiles(x, y, cnt, tile_ptr);
+    return 1;
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    if (tx >= tileWidth || ty >= tileHeight) return;
+    if (tx + tw > tileWidth) tw = tileWidth - tx;
+    if (ty + th > tileHeight) th = tileHeight - ty;
+    for (uint8_t row = ty; row < ty + th; row++) {
+        drawTiles(tx, row, tw, buffer + (row * tileWidth + tx) * 8);
+    }
+}
+
+unsigned long U8G2::getTotalDrawCalls() const {
+    unsigned long total = 0;
+    for (int i = 0; i < CALL_COUNT; i++) total += drawCalls[i];
+    return total;
+}
+
+void U8G2::setPixel(int x, int y) {
+    if (x < 0 || y < 0 || x >= tileWidth * 8 || y >= tileHeight * 8) return;
+    uint8_t *ptr = buffer + (y >> 3) * tileWidth * 8 + x;
+    uint8_t mask = 1 << (y & 7);
+    switch (drawColor) {
+        case 0: *ptr &= ~mask; break;
+        case 1: *ptr |= mask; break;
+        default: *ptr ^= mask; break;
+    }
+}
+
+void U8G2::drawPixel(int x, int y) {
+    drawCalls[CALL_PIXEL]++;
+    setPixel(x, y);
+}
+
+void U8G2::drawHLine(int x, int y, int w) {
+    drawCalls[CALL_HLINE]++;
+    for (int i = 0; i < w; i++) setPixel(x + i, y);
+}
+
+void U8G2::drawVLine(int x, int y, int h) {
+    drawCalls[CALL_VLINE]++;
+    for (int i = 0; i < h; i++) setPixel(x, y + i);
+}
+
+void U8G2::drawBox(int x, int y, int w, int h) {
+    drawCalls[CALL_BOX]++;
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) setPixel(x + i, y + j);
+    }
+}
+
+void U8G2::drawFrame(int x, int y, int w, int h) {
+    drawCalls[CALL_FRAME]++;
+    for (int i = 0; i < w; i++) setPixel(x + i, y);
+    if (h < 2) return;
+    for (int j = 1; j < h - 1; j++) {
+        setPixel(x, y + j);
+        setPixel(x + w - 1, y + j);
+    }
+    for (int i = 0; i < w; i++) setPixel(x + i, y + h - 1);
+}
+
+void U8G2::drawLine(int x1, int y1, int x2, int y2) {
+    drawCalls[CALL_LINE]++;
+
+    // Same Bresenham walk as u8g2_DrawLine
+    int dx = abs(x2 - x1);
+    int dy = abs(y2 - y1);
+    bool swapxy = dy > dx;
+    if (swapxy) {
+        std::swap(dx, dy);
+        std::swap(x1, y1);
+        std::swap(x2, y2);
+    }
+    if (x1 > x2) {
+        std::swap(x1, x2);
+        std::swap(y1, y2);
+    }
+    int err = dx >> 1;
+    int ystep = y2 > y1 ? 1 : -1;
+    int y = y1;
+    for (int x = x1; x <= x2; x++) {
+        if (swapxy) setPixel(y, x); else setPixel(x, y);
+        err -= dy;
+        if (err < 0) {
+            y += ystep;
+            err += dx;
+        }
+    }
+}
+
+void U8G2::drawCircleSection(int x, int y, int x0, int y0) {
+    setPixel(x0 + x, y0 - y);
+    setPixel(x0 + y, y0 - x);
+    setPixel(x0 - x, y0 - y);
+    setPixel(x0 - y, y0 - x);
+    setPixel(x0 + x, y0 + y);
+    setPixel(x0 + y, y0 + x);
+    setPixel(x0 - x, y0 + y);
+    setPixel(x0 - y, y0 + x);
+}
+
+void U8G2::drawDiscSection(int x, int y, int x0, int y0) {
+    for (int i = 0; i <= y; i++) {
+        setPixel(x0 + x, y0 - i);
+        setPixel(x0 - x, y0 - i);
+        setPixel(x0 + x, y0 + i);
+        setPixel(x0 - x, y0 + i);
+    }
+    for (int i = 0; i <= x; i++) {
+        setPixel(x0 + y, y0 - i);
+        setPixel(x0 - y, y0 - i);
+        setPixel(x0 + y, y0 + i);
+        setPixel(x0 - y, y0 + i);
+    }
+}
+
+void U8G2::drawCircle(int x0, int y0, int rad) {
+    drawCalls[CALL_CIRCLE]++;
+    int f = 1 - rad;
+    int ddF_x = 1;
+    int ddF_y = -2 * rad;
+    int x = 0;
+    int y = rad;
+    drawCircleSection(x, y, x0, y0);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        drawCircleSection(x, y, x0, y0);
+    }
+}
+
+void U8G2::drawDisc(int x0, int y0, int rad) {
+    drawCalls[CALL_DISC]++;
+    int f = 1 - rad;
+    int ddF_x = 1;
+    int ddF_y = -2 * rad;
+    int x = 0;
+    int y = rad;
+    drawDiscSection(x, y, x0, y0);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        drawDiscSection(x, y, x0, y0);
+    }
+}
+
+// One side of U8g2's polygon fill (u8g2_polygon.c): Bresenham from a point
+// to the next, one step per scanline
+struct PolygonEdge {
+    int direction, height, step, errorStep;
+    int x, y, maxY, error;
+    int index;
+
+    void start(int xa, int ya, int xb, int yb) {
+        int dx = xb - xa;
+        height = yb - ya;
+        maxY = yb;
+        x = xa;
+        y = ya;
+        direction = dx >= 0 ? 1 : -1;
+        error = dx >= 0 ? 0 : 1 - height;
+        // Edges that don't go down are never stepped
+        step = height > 0 ? dx / height : 0;
+        errorStep = height > 0 ? abs(dx) % height : 0;
+    }
+
+    bool next() {
+        if (y >= maxY) return false;
+        x += step;
+        error += errorStep;
+        if (error > 0) {
+            x += direction;
+            error -= height;
+        }
+        y++;
+        return true;
+    }
+};
+
+// The right edge (1) walks the points forwards, the left one (0) backwards
+static int nextTrianglePoint(int i, int edge) {
+    return edge ? (i + 1) % 3 : (i + 2) % 3;
+}
+
+void U8G2::drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+    drawCalls[CALL_TRIANGLE]++;
+
+    // U8g2 fills a triangle as a polygon: a pointed top starts one line
+    // down, and each line fills [left, right)
+    const int xs[3] = {x0, x1, x2};
+    const int ys[3] = {y0, y1, y2};
+
+    int minY = ys[0];
+    int maxY = ys[0];
+    int top = 0;
+    for (int i = 1; i < 3; i++) {
+        if (maxY < ys[i]) maxY = ys[i];
+        if (minY > ys[i]) {
+            top = i;
+            minY = ys[i];
+        }
+    }
+    int lines = maxY - minY;
+    if (lines == 0) return;
+
+    PolygonEdge edges[2] = {};
+    for (int e = 0; e < 2; e++) {
+        edges[e].index = top;
+        for (;;) {
+            int i = nextTrianglePoint(edges[e].index, e);
+            if (ys[i] != minY) break;
+            edges[e].index = i;
+        }
+    }
+    const bool pointedTop = xs[edges[0].index] == xs[edges[1].index];
+
+    auto startEdge = [&](PolygonEdge &edge, int side) {
+        int from = edge.index;
+        edge.index = nextTrianglePoint(from, side);
+        edge.start(xs[from], ys[from], xs[edge.index], ys[edge.index]);
+    };
+    for (int e = 0; e < 2; e++) startEdge(edges[e], e);
+    if (pointedTop) {
+        edges[0].next();
+        edges[1].next();
+    }
+    do {
+        int left = std::min(edges[0].x, edges[1].x);
+        int right = std::max(edges[0].x, edges[1].x);
+        for (int x = left; x < right; x++) setPixel(x, edges[1].y);
+        for (int e = 0; e < 2; e++) {
+            while (!edges[e].next()) startEdge(edges[e], e);
+        }
+    } while (--lines > 0);
+}
+
+u8g2_uint_t U8G2::drawStr(int x, int y, const char *s) {
+    drawCalls[CALL_STR]++;
+    const int advance = font[0];
+    const int height = font[1];
+    int width = 0;
+
+    for (; *s; s++, x += advance, width += advance) {
+        char c = *s;
+        if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+        if (c < ' ' || c > 'Z') continue;
+
+        uint16_t glyph = hostGlyphs[c - ' '];
+        for (int row = 0; row < height; row++) {
+            for (int col = 0; col < 3; col++) {
+                if (glyph & (1 << (14 - row * 3 - col))) {
+                    setPixel(x + col, y - height + row);
+                }
+            }
+        }
+    }
+    return width;
+}
@@ -0,0 +1,219 @@
+#ifndef HOST_U8G2LIB_H
+#define HOST_U8G2LIB_H
+
+// In-memory stand-in for the parts of U8g2 the renderer uses.
+//
+// The buffer uses the same SSD1306 page layout as U8g2's full buffer mode
+// (one byte per column per 8 pixel page, LSB on top). Transfers go through
+// the same u8x8 layers as on the device: the display sends commands and
+// data to the cad callback, which frames them into I2C transactions for the
+// byte callback. The defaults replicate U8g2's u8x8_cad_ssd13xx_fast_i2c
+// and u8x8_byte_arduino_hw_i2c byte for byte into the recording Wire, so
+// bus statistics match the device and replacement callbacks can be checked
+// against them.
+
+#include <Arduino.h>
+#include <Wire.h>
+
+typedef uint16_t u8g2_uint_t;
+
+struct u8g2_cb_t {
+    uint8_t rotation;
+};
+extern const u8g2_cb_t *const U8G2_R0;
+
+#define U8X8_PIN_NONE 255
+
+// Font handles, all fonts render with the built-in 3x5 host glyphs
+extern const uint8_t u8g2_font_4x6_tf[];
+extern const uint8_t u8g2_font_ncenB10_tr[];
+
+class U8G2;
+struct u8x8_t;
+
+typedef uint8_t (*u8x8_msg_cb)(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+// Message numbers as in U8g2's u8x8.h, the byte messages share the cad ones
+#define U8X8_MSG_CAD_INIT 20
+#define U8X8_MSG_CAD_SEND_CMD 21
+#define U8X8_MSG_CAD_SEND_ARG 22
+#define U8X8_MSG_CAD_SEND_DATA 23
+#define U8X8_MSG_CAD_START_TRANSFER 24
+#define U8X8_MSG_CAD_END_TRANSFER 25
+#define U8X8_MSG_BYTE_INIT U8X8_MSG_CAD_INIT
+#define U8X8_MSG_BYTE_SET_DC U8X8_MSG_CAD_SEND_ARG
+#define U8X8_MSG_BYTE_SEND U8X8_MSG_CAD_SEND_DATA
+#define U8X8_MSG_BYTE_START_TRANSFER U8X8_MSG_CAD_START_TRANSFER
+#define U8X8_MSG_BYTE_END_TRANSFER U8X8_MSG_CAD_END_TRANSFER
+
+#define U8X8_PIN_I2C_CLOCK 0
+#define U8X8_PIN_I2C_DATA 1
+#define U8X8_PIN_CNT 2
+
+// Low level (u8x8) handle, the fields the transport layers use
+struct u8x8_t {
+    U8G2 *owner;
+    u8x8_msg_cb cad_cb;
+    u8x8_msg_cb byte_cb;
+    uint32_t bus_clock;
+    uint8_t i2c_address;          // 8 bit form, 255 until the cad sets its default
+    uint8_t pins[U8X8_PIN_CNT];
+};
+
+#define u8x8_GetI2CAddress(u8x8) ((u8x8)->i2c_address)
+
+inline uint8_t u8x8_byte_SendBytes(u8x8_t *u8x8, uint8_t cnt, uint8_t *data) {
+    return u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_SEND, cnt, data);
+}
+inline uint8_t u8x8_byte_SendByte(u8x8_t *u8x8, uint8_t byte) {
+    return u8x8_byte_SendBytes(u8x8, 1, &byte);
+}
+inline uint8_t u8x8_byte_StartTransfer(u8x8_t *u8x8) {
+    return u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+}
+inline uint8_t u8x8_byte_EndTransfer(u8x8_t *u8x8) {
+    return u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+}
+
+inline uint8_t u8x8_cad_SendCmd(u8x8_t *u8x8, uint8_t cmd) {
+    return u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_CMD, cmd, nullptr);
+}
+inline uint8_t u8x8_cad_SendArg(u8x8_t *u8x8, uint8_t arg) {
+    return u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_ARG, arg, nullptr);
+}
+inline uint8_t u8x8_cad_SendData(u8x8_t *u8x8, uint8_t cnt, uint8_t *data) {
+    return u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_DATA, cnt, data);
+}
+inline uint8_t u8x8_cad_StartTransfer(u8x8_t *u8x8) {
+    return u8x8->cad_cb(u8x8, U8X8_MSG_CAD_START_TRANSFER, 0, nullptr);
+}
+inline uint8_t u8x8_cad_EndTransfer(u8x8_t *u8x8) {
+    return u8x8->cad_cb(u8x8, U8X8_MSG_CAD_END_TRANSFER, 0, nullptr);
+}
+
+// U8g2's own transport callbacks, the constructor defaults
+uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+
+class U8G2 {
+public:
+    enum DrawCall {
+        CALL_PIXEL,
+        CALL_HLINE,
+        CALL_VLINE,
+        CALL_BOX,
+        CALL_FRAME,
+        CALL_LINE,
+        CALL_CIRCLE,
+        CALL_DISC,
+        CALL_TRIANGLE,
+        CALL_STR,
+        CALL_COUNT
+    };
+
+protected:
+    uint8_t tileWidth, tileHeight;
+    uint8_t columnOffset;          // Controller column of buffer column 0
+    uint8_t buffer[16 * 8 * 8];
+    uint8_t panel[16 * 8 * 8];     // Display RAM as written over I2C
+    uint8_t drawColor;
+    const uint8_t *font;
+    unsigned long drawCalls[CALL_COUNT];
+    u8x8_t u8x8;
+
+    void setPixel(int x, int y);
+    void drawDiscSection(int x, int y, int x0, int y0);
+    void drawCircleSection(int x, int y, int x0, int y0);
+
+    // Display driver part: commands and tile data through the cad callback
+    void drawTiles(uint8_t tx, uint8_t ty, uint8_t tw, const uint8_t *tiles);
+
+    friend uint8_t u8x8_DrawTile(u8x8_t *, uint8_t, uint8_t, uint8_t, uint8_t *);
+
+public:
+    U8G2(uint8_t tilesWide = 16, uint8_t tilesHigh = 8, uint8_t xOffset = 0,
+         uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE);
+
+    bool begin();
+    void setContrast(uint8_t value);
+    void setBusClock(uint32_t clockSpeed) { u8x8.bus_clock = clockSpeed; }
+    void setPowerSave(uint8_t isEnable);
+
+    void clearBuffer() { memset(buffer, 0, tileWidth * tileHeight * 8); }
+    void sendBuffer() { updateDisplayArea(0, 0, tileWidth, tileHeight); }
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    void clearDisplay() { clearBuffer(); sendBuffer(); }
+
+    uint8_t *getBufferPtr() { return buffer; }
+    u8x8_t *getU8x8() { return &u8x8; }
+    uint8_t getBufferTileWidth() const { return tileWidth; }
+    uint8_t getBufferTileHeight() const { return tileHeight; }
+    u8g2_uint_t getDisplayWidth() const { return tileWidth * 8; }
+    u8g2_uint_t getDisplayHeight() const { return tileHeight * 8; }
+
+    void setDrawColor(uint8_t color) { drawColor = color; }
+    uint8_t getDrawColor() const { return drawColor; }
+
+    void drawPixel(int x, int y);
+    void drawHLine(int x, int y, int w);
+    void drawVLine(int x, int y, int h);
+    void drawBox(int x, int y, int w, int h);
+    void drawFrame(int x, int y, int w, int h);
+    void drawLine(int x1, int y1, int x2, int y2);
+    void drawCircle(int x0, int y0, int rad);
+    void drawDisc(int x0, int y0, int rad);
+    void drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+
+    void setFont(const uint8_t *f) { font = f; }
+    void setFontMode(uint8_t isTransparent) { (void)isTransparent; }
+    u8g2_uint_t drawStr(int x, int y, const char *s);
+    u8g2_uint_t getStrWidth(const char *s) const { return strlen(s) * 4; }
+
+    // What the panel shows, same layout as the buffer (host only)
+    const uint8_t *getPanelPtr() const { return panel; }
+
+    // Draw call profiling (host only)
+    unsigned long getDrawCalls(DrawCall call) const { return drawCalls[call]; }
+    unsigned long getTotalDrawCalls() const;
+    void resetDrawCalls() { memset(drawCalls, 0, sizeof(drawCalls)); }
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t *rotation,
+                                        uint8_t reset = U8X8_PIN_NONE,
+                                        uint8_t clock = U8X8_PIN_NONE,
+                                        uint8_t data = U8X8_PIN_NONE)
+        : U8G2(16, 8, 0, clock, data) {
+        (void)rotation; (void)reset;
+    }
+};
+
+// Native 72x40 drivers: 9x5 tile buffer, the driver moves column 0 to the
+// first visible controller column. All variants share the SSD1306 init
+// sequence here, only the transfer framing matters on the host.
+class U8G2_SH1106_72X40_WISE_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SH1106_72X40_WISE_F_HW_I2C(const u8g2_cb_t *rotation,
+                                    uint8_t reset = U8X8_PIN_NONE,
+                                    uint8_t clock = U8X8_PIN_NONE,
+                                    uint8_t data = U8X8_PIN_NONE)
+        : U8G2(9, 5, 30, clock, data) {
+        (void)rotation; (void)reset;
+    }
+};
+
+class U8G2_SSD1306_72X40_ER_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SSD1306_72X40_ER_F_HW_I2C(const u8g2_cb_t *rotation,
+                                   uint8_t reset = U8X8_PIN_NONE,
+                                   uint8_t clock = U8X8_PIN_NONE,
+                                   uint8_t data = U8X8_PIN_NONE)
+        : U8G2(9, 5, 28, clock, data) {
+        (void)rotation; (void)reset;
+    }
+};
+
+#endif // HOST_U8G2LIB_H
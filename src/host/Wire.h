@@ -0,0 +1,86 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+#include <vector>
+
+// I2C master that records traffic instead of driving a bus
+class TwoWire {
+public:
+    struct Transaction {
+        uint8_t address;
+        std::vector<uint8_t> data;
+    };
+
+private:
+    uint32_t clock;
+    size_t bufferSize;
+    bool capturing;
+    bool simulateBusTime;
+    Transaction current;
+    std::vector<Transaction> captured;
+
+    unsigned long transactionCount;
+    unsigned long byteCount;      // Payload plus address byte
+    uint64_t busTimeNs;
+
+public:
+    TwoWire() : clock(100000), bufferSize(128), capturing(false), simulateBusTime(true),
+                transactionCount(0), byteCount(0), busTimeNs(0) {}
+
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+        (void)sda; (void)scl;
+        if (frequency) clock = frequency;
+        return true;
+    }
+    bool setClock(uint32_t frequency) { clock = frequency; return true; }
+    uint32_t getClock() const { return clock; }
+
+    // Transmit buffer, bytes past it are dropped like on the ESP32
+    size_t setBufferSize(size_t size) { bufferSize = size; return size; }
+
+    void beginTransmission(uint8_t address) {
+        current.address = address;
+        current.data.clear();
+    }
+    size_t write(uint8_t value) {
+        return write(&value, 1);
+    }
+    size_t write(const uint8_t *data, size_t size) {
+        size = min(size, bufferSize - current.data.size());
+        current.data.insert(current.data.end(), data, data + size);
+        return size;
+    }
+    uint8_t endTransmission(bool sendStop = true) {
+        (void)sendStop;
+        size_t bytes = current.data.size() + 1;
+        transactionCount++;
+        byteCount += bytes;
+        // 9 clocks per byte plus roughly 2 for start and stop
+        uint64_t transactionNs = (uint64_t)(bytes * 9 + 2) * 1000000000ULL / clock;
+        busTimeNs += transactionNs;
+        if (simulateBusTime) HostClock::advanceMicros(transactionNs / 1000);
+        if (capturing) captured.push_back(current);
+        return 0;
+    }
+
+    // Blocking transfers advance the simulated clock like they stall the CPU
+    void setSimulateBusTime(bool enabled) { simulateBusTime = enabled; }
+
+    // Recorder access
+    void setCapture(bool enabled) { capturing = enabled; captured.clear(); }
+    const std::vector<Transaction> &getCaptured() const { return captured; }
+    unsigned long getTransactionCount() const { return transactionCount; }
+    unsigned long getByteCount() const { return byteCount; }
+    uint64_t getBusTimeNs() const { return busTimeNs; }
+    void resetStats() {
+        transactionCount = 0;
+        byteCount = 0;
+        busTimeNs = 0;
+        captured.clear();
+    }
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
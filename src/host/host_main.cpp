@@ -0,0 +1,953 @@
+// Host runner for the native environment
+//
+// Runs setup() and loop() from main.cpp against the simulated clock, the
+// in-memory display and the recording Wire, and reports draw calls and I2C
+// traffic per frame. Hashes and dumps show the panel contents, i.e. what
+// was actually transferred, not the render buffer.
+//
+//   program [--frames N] [--seed N] [--csv] [--quiet] [--mirror] [--no-skip]
+//           [--dump DIR] [--hashes FILE] [--check FILE]
+//
+// --mirror turns on the framebuffer mirror, its packets go to stdout
+// with the log (pipe into tools/mirror_view.py). Frames are slots of the
+// 20 fps schedule; --no-skip renders every one of them instead of
+// sleeping through those where nothing changes, the hashes must not
+// change.
+//   program --bench [FILTER]
+//   program --stress-pipeline N
+//   program --suite [FILTER] [--frames N] [--seed N] [--hashes FILE] [--check FILE]
+//   program --compare-i2c [--frames N]
+//   program --check-scroll [--frames N]
+//
+// --suite renders every scene (weather held at snow), every weather
+// state (in the weather scene) and every scene transition (into the scene
+// that plays it) for N frames each, every case in a fresh process from
+// setup() so cases don't depend on each other or on the filter. One CSV
+// line per case goes to stdout: host ns, draw calls and I2C traffic per
+// frame, and how the frame hashes compare with the golden file given to
+// --check (bench/golden_frames.txt); --hashes writes one. Transition cases
+// also fail if their slowest frame, or its bus time, overruns the frame
+// period.
+//
+// --compare-i2c runs the same frames through U8g2's own I2C transport and
+// through the coalescing one (I2cTransport.h) and checks that the panel
+// receives the same command and data bytes, then compares their cost.
+//
+// --check-scroll runs the banner in software and in hardware scroll mode
+// (BannerScroll.h) and replays the hardware run's I2C stream into a mock
+// SSD1306 that enforces the scroll rules, then compares their cost. Run it
+// long enough to pass the flyover scene (600 frames) so a stop is covered.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <U8g2lib.h>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "../config.h"
+#include "../FramePipeline.h"
+#include "../FramePacer.h"
+#include "../FrameHash.h"
+
+void setup();
+void loop();
+void runBenchmarks(const char* filter);
+void flushSerial();
+void setFrameMirror(bool enabled);
+extern bool useI2cCoalescing;
+extern bool useHardwareScroll;
+extern bool useRenderSkip;
+extern FramePacer framePacer;
+extern FrameHash<Panel> frameHash;
+void pinScene(int scene, int weather);
+void pinTransition(int from, int to);
+const char *sceneName(uint8_t scene);
+uint8_t sceneCount();
+const char *weatherName(uint8_t weather);
+uint8_t weatherCount();
+const char *transitionName(uint8_t kind);
+uint8_t transitionCount();
+
+extern Panel::Display u8g2;
+
+// FNV-1a over the animation window, column-major page bytes
+static uint32_t hashWindow(U8G2 &display) {
+    const uint8_t *buffer = display.getPanelPtr();
+    const int stride = display.getBufferTileWidth() * 8;
+    uint32_t hash = 2166136261u;
+    for (int y = Y_OFFSET; y < Y_OFFSET + FRAME_HEIGHT; y++) {
+        for (int x = X_OFFSET; x < X_OFFSET + FRAME_WIDTH; x++) {
+            uint8_t bit = (buffer[(y >> 3) * stride + x] >> (y & 7)) & 1;
+            hash = (hash ^ bit) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+// Binary PBM of the animation window
+static bool writeWindowPbm(U8G2 &display, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (!file) return false;
+
+    const uint8_t *buffer = display.getPanelPtr();
+    const int stride = display.getBufferTileWidth() * 8;
+    fprintf(file, "P4\n%d %d\n", FRAME_WIDTH, FRAME_HEIGHT);
+    for (int y = Y_OFFSET; y < Y_OFFSET + FRAME_HEIGHT; y++) {
+        uint8_t packed[(FRAME_WIDTH + 7) / 8] = {0};
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            if ((buffer[(y >> 3) * stride + X_OFFSET + x] >> (y & 7)) & 1) {
+                packed[x / 8] |= 0x80 >> (x & 7);
+            }
+        }
+        fwrite(packed, 1, sizeof(packed), file);
+    }
+    fclose(file);
+    return true;
+}
+
+// Pipeline handoff under real threads: every frame carries its sequence
+// number and a pattern derived from it; the sending side checks that frames
+// arrive complete (no tearing from a buffer overwritten mid-send), in order
+// and none are lost. Both sides yield at random points to shake the timing.
+static uint32_t stressExpected;
+static unsigned long stressTorn, stressOutOfOrder;
+
+static uint8_t stressPattern(uint32_t sequence, size_t index) {
+    return (uint8_t)(sequence * 31 + index * 7);
+}
+
+static bool randomYield() {
+    static thread_local uint32_t state = 0x9e3779b9u ^ (uint32_t)(uintptr_t)&state;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    if ((state & 7) == 0) std::this_thread::yield();
+    return (state & 63) == 0;
+}
+
+static void stressSend(const uint8_t *frame, uint8_t flags) {
+    uint32_t sequence;
+    memcpy(&sequence, frame, sizeof(sequence));
+    if (sequence != stressExpected) stressOutOfOrder++;
+    stressExpected = sequence + 1;
+    if (flags != (uint8_t)(sequence * 7)) stressTorn++;  // Flags belong to their frame
+
+    for (size_t i = sizeof(sequence); i < FRAME_BUFFER_BYTES; i++) {
+        if (frame[i] != stressPattern(sequence, i)) {
+            stressTorn++;
+            break;
+        }
+        if (i % 256 == 0) randomYield();
+    }
+}
+
+static int stressPipeline(unsigned long frames) {
+    static uint8_t render[FRAME_BUFFER_BYTES];
+    FramePipeline pipeline(stressSend);
+    stressExpected = 0;
+    stressTorn = 0;
+    stressOutOfOrder = 0;
+
+    uint64_t start = HostClock::nowNs();
+    pipeline.begin();
+    for (uint32_t sequence = 0; sequence < frames; sequence++) {
+        memcpy(render, &sequence, sizeof(sequence));
+        for (size_t i = sizeof(sequence); i < FRAME_BUFFER_BYTES; i++) {
+            render[i] = stressPattern(sequence, i);
+        }
+        pipeline.submit(render, (uint8_t)(sequence * 7));
+        // Scribble over the render buffer straight away, like loop() does
+        memset(render, 0xa5, sizeof(render));
+
+        // Occasionally restart the task to cover begin()/end()
+        if (randomYield() && (sequence & 1)) {
+            pipeline.end();
+            pipeline.begin();
+        }
+    }
+    pipeline.end();
+    uint64_t elapsed = HostClock::nowNs() - start;
+
+    printf("pipeline stress: %lu frames, %lu sent, %lu torn, %lu out of order, "
+           "%lu waited, %.0f ns/frame\n",
+           frames, stressExpected == frames ? frames : (unsigned long)stressExpected,
+           stressTorn, stressOutOfOrder, pipeline.getBlockedSubmits(),
+           frames ? (double)elapsed / frames : 0);
+    return (stressTorn || stressOutOfOrder || stressExpected != frames) ? 1 : 0;
+}
+
+// One frame slot of the schedule. With render skipping a loop() call can
+// sleep through the slots after its frame, those get no loop() of their
+// own and the panel stays as it was, so every mode counts frames in
+// slots (time) either way.
+static bool runSlot() {
+    static uint16_t sleptSlots = 0;
+    if (sleptSlots > 0) {
+        sleptSlots--;
+        return false;
+    }
+    loop();
+    sleptSlots = framePacer.getLastSkipped();
+    return true;
+}
+
+// Measurements for one frame slot
+struct FrameSample {
+    bool rendered;
+    bool unchanged;     // Rendered, but the same picture as the last sent
+    uint64_t ns;
+    unsigned long drawCalls;
+    unsigned long transactions;
+    unsigned long bytes;
+    uint64_t busNs;
+    uint32_t hash;
+};
+
+static FrameSample renderFrame() {
+    u8g2.resetDrawCalls();
+    Wire.resetStats();
+
+    uint64_t start = HostClock::nowNs();
+    bool rendered = runSlot();
+    uint64_t elapsed = HostClock::nowNs() - start;
+
+    return {rendered, rendered && frameHash.wasUnchanged(), elapsed, u8g2.getTotalDrawCalls(),
+            Wire.getTransactionCount(), Wire.getByteCount(), Wire.getBusTimeNs(), hashWindow(u8g2)};
+}
+
+// Scene/weather suite
+struct SuiteCase {
+    std::string name;
+    int scene;
+    int weather;
+    int from;   // Scene the case transitions out of, -1 for none
+};
+
+struct SuiteTotals {
+    uint64_t rendered, ns, drawCalls, transactions, bytes, busNs;
+    uint64_t maxNs, maxBusNs;
+};
+
+typedef std::map<std::string, std::vector<uint32_t>> GoldenFrames;
+
+static std::vector<SuiteCase> suiteCases(const char *filter) {
+    std::vector<SuiteCase> cases;
+    int weatherScene = -1;
+    for (uint8_t scene = 0; scene < sceneCount(); scene++) {
+        if (!strcmp(sceneName(scene), "weather")) weatherScene = scene;
+        cases.push_back({std::string("scene/") + sceneName(scene), scene, 0, -1});
+    }
+    for (uint8_t weather = 0; weather < weatherCount() && weatherScene >= 0; weather++) {
+        cases.push_back({std::string("weather/") + weatherName(weather), weatherScene, weather, -1});
+    }
+    // Scene n is entered with transition n % count, from the scene before it
+    for (uint8_t kind = 0; kind < transitionCount() && kind < sceneCount(); kind++) {
+        cases.push_back({std::string("transition/") + transitionName(kind), kind, 0,
+                         (kind + sceneCount() - 1) % sceneCount()});
+    }
+
+    std::vector<SuiteCase> selected;
+    for (const SuiteCase &c : cases) {
+        if (!filter || strstr(c.name.c_str(), filter)) selected.push_back(c);
+    }
+    return selected;
+}
+
+static bool transfer(int fd, void *data, size_t size, bool writing) {
+    uint8_t *bytes = (uint8_t *)data;
+    while (size > 0) {
+        ssize_t done = writing ? write(fd, bytes, size) : read(fd, bytes, size);
+        if (done <= 0) return false;
+        bytes += done;
+        size -= done;
+    }
+    return true;
+}
+
+// Runs work in a child process from a fresh setup(), so it starts from the
+// same state as a boot whatever ran before it. work serialises its results
+// into the bytes handed back to the parent.
+static bool runIsolated(unsigned int seed, const std::function<void(std::vector<uint8_t> &)> &work,
+                        std::vector<uint8_t> &result) {
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        close(fds[0]);
+        Serial.setMuted(true);
+        HostClock::setMicros(0);
+        HostRandom::setAnalogNoise(seed);
+        std::vector<uint8_t> bytes;
+        work(bytes);
+        uint64_t size = bytes.size();
+        bool ok = transfer(fds[1], &size, sizeof(size), true) &&
+                  transfer(fds[1], bytes.data(), bytes.size(), true);
+        _exit(ok ? 0 : 1);
+    }
+
+    close(fds[1]);
+    uint64_t size = 0;
+    bool ok = transfer(fds[0], &size, sizeof(size), false);
+    if (ok) {
+        result.resize(size);
+        ok = transfer(fds[0], result.data(), size, false);
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+template <typename T>
+static void appendBytes(std::vector<uint8_t> &bytes, const T *values, size_t count) {
+    const uint8_t *data = (const uint8_t *)values;
+    bytes.insert(bytes.end(), data, data + count * sizeof(T));
+}
+
+template <typename T>
+static const uint8_t *takeBytes(const uint8_t *bytes, T *values, size_t count) {
+    memcpy(values, bytes, count * sizeof(T));
+    return bytes + count * sizeof(T);
+}
+
+static bool runSuiteCase(const SuiteCase &c, unsigned long frames, unsigned int seed,
+                         SuiteTotals &totals, std::vector<uint32_t> &hashes,
+                         std::vector<uint64_t> &frameNs) {
+    std::vector<uint8_t> result;
+    bool ok = runIsolated(seed, [&](std::vector<uint8_t> &out) {
+        // Bus time is still counted, but kept off the clock so the hashes
+        // only depend on rendering, not on the bus speed
+        Wire.setSimulateBusTime(false);
+        setup();
+        if (c.from >= 0) {
+            pinTransition(c.from, c.scene);
+        } else {
+            pinScene(c.scene, c.weather);
+        }
+
+        SuiteTotals sums = {};
+        std::vector<uint32_t> frameHashes(frames);
+        std::vector<uint64_t> times(frames);
+        for (unsigned long frame = 0; frame < frames; frame++) {
+            FrameSample sample = renderFrame();
+            times[frame] = sample.ns;
+            sums.rendered += sample.rendered;
+            sums.ns += sample.ns;
+            sums.drawCalls += sample.drawCalls;
+            sums.transactions += sample.transactions;
+            sums.bytes += sample.bytes;
+            sums.busNs += sample.busNs;
+            sums.maxNs = std::max(sums.maxNs, sample.ns);
+            sums.maxBusNs = std::max(sums.maxBusNs, sample.busNs);
+            frameHashes[frame] = sample.hash;
+        }
+        appendBytes(out, &sums, 1);
+        appendBytes(out, frameHashes.data(), frames);
+        appendBytes(out, times.data(), frames);
+    }, result);
+
+    size_t expected = sizeof(totals) + frames * (sizeof(uint32_t) + sizeof(uint64_t));
+    if (!ok || result.size() != expected) return false;
+    hashes.resize(frames);
+    frameNs.resize(frames);
+    const uint8_t *bytes = takeBytes(result.data(), &totals, 1);
+    bytes = takeBytes(bytes, hashes.data(), frames);
+    takeBytes(bytes, frameNs.data(), frames);
+    return true;
+}
+
+// I2C framing check. Bus time is kept off the simulated clock so both
+// transports render the same frames; every captured transaction is expanded
+// into what the controller sees, one entry per byte: address << 9, the
+// control byte's D/C bit << 8, then the command or data byte.
+struct I2cCapture {
+    std::vector<uint32_t> stream;
+    std::vector<uint16_t> frameTransactions;  // Transaction lengths after setup(), address included
+};
+
+static void expandTransaction(const TwoWire::Transaction &transaction, std::vector<uint32_t> &stream) {
+    const std::vector<uint8_t> &data = transaction.data;
+    size_t i = 0;
+    while (i < data.size()) {
+        uint8_t control = data[i++];
+        uint32_t tag = (uint32_t)transaction.address << 9 | (control & 0x40 ? 0x100 : 0);
+        if (control & 0x80) {
+            // Continuation set: one byte, then another control byte
+            if (i < data.size()) stream.push_back(tag | data[i++]);
+            continue;
+        }
+        while (i < data.size()) stream.push_back(tag | data[i++]);
+    }
+}
+
+static bool captureI2c(bool coalesce, unsigned long frames, unsigned int seed, I2cCapture &capture) {
+    std::vector<uint8_t> result;
+    bool ok = runIsolated(seed, [&](std::vector<uint8_t> &out) {
+        useI2cCoalescing = coalesce;
+        Wire.setSimulateBusTime(false);
+        Wire.setCapture(true);
+        setup();
+        size_t setupTransactions = Wire.getCaptured().size();
+        for (unsigned long frame = 0; frame < frames; frame++) runSlot();
+
+        std::vector<uint32_t> stream;
+        std::vector<uint16_t> lengths;
+        const std::vector<TwoWire::Transaction> &captured = Wire.getCaptured();
+        for (size_t i = 0; i < captured.size(); i++) {
+            expandTransaction(captured[i], stream);
+            if (i >= setupTransactions) lengths.push_back(captured[i].data.size() + 1);
+        }
+        uint64_t counts[2] = {stream.size(), lengths.size()};
+        appendBytes(out, counts, 2);
+        appendBytes(out, stream.data(), stream.size());
+        appendBytes(out, lengths.data(), lengths.size());
+    }, result);
+
+    uint64_t counts[2];
+    if (!ok || result.size() < sizeof(counts)) return false;
+    const uint8_t *bytes = takeBytes(result.data(), counts, 2);
+    if (result.size() != sizeof(counts) + counts[0] * sizeof(uint32_t) + counts[1] * sizeof(uint16_t)) {
+        return false;
+    }
+    capture.stream.resize(counts[0]);
+    capture.frameTransactions.resize(counts[1]);
+    bytes = takeBytes(bytes, capture.stream.data(), counts[0]);
+    takeBytes(bytes, capture.frameTransactions.data(), counts[1]);
+    return true;
+}
+
+// Same bus time model as the recording Wire
+static double busUs(const std::vector<uint16_t> &lengths, uint32_t clock) {
+    double ns = 0;
+    for (uint16_t bytes : lengths) ns += (double)(bytes * 9 + 2) * 1e9 / clock;
+    return ns / 1000;
+}
+
+// Fast-mode Plus, the opt-in clock, compared against the 400 kHz default
+constexpr uint32_t I2C_FAST_MODE_PLUS = 1000000;
+
+static int compareI2c(unsigned long frames, unsigned int seed) {
+    I2cCapture reference, coalesced;
+    if (!captureI2c(false, frames, seed, reference) || !captureI2c(true, frames, seed, coalesced)) {
+        fprintf(stderr, "i2c capture failed\n");
+        return 1;
+    }
+
+    double n = frames ? (double)frames : 1;
+    printf("framing,transactions_per_frame,bytes_per_frame,bus_us_per_frame_400k,bus_us_per_frame_%luk\n",
+           (unsigned long)(I2C_FAST_MODE_PLUS / 1000));
+    const I2cCapture *captures[] = {&reference, &coalesced};
+    const char *names[] = {"u8g2", "coalesced"};
+    for (int i = 0; i < 2; i++) {
+        const std::vector<uint16_t> &lengths = captures[i]->frameTransactions;
+        unsigned long bytes = 0;
+        for (uint16_t length : lengths) bytes += length;
+        printf("%s,%.1f,%.1f,%.0f,%.0f\n", names[i], lengths.size() / n, bytes / n,
+               busUs(lengths, 400000) / n, busUs(lengths, I2C_FAST_MODE_PLUS) / n);
+    }
+
+    fflush(stdout);
+    const std::vector<uint32_t> &a = reference.stream, &b = coalesced.stream;
+    size_t common = min(a.size(), b.size());
+    size_t first = std::mismatch(a.begin(), a.begin() + common, b.begin()).first - a.begin();
+    if (first == common && a.size() == b.size()) {
+        fprintf(stderr, "command/data stream identical: %zu bytes over %lu frames\n", a.size(), frames);
+        return 0;
+    }
+    fprintf(stderr, "command/data stream differs at byte %zu of %zu/%zu\n", first, a.size(), b.size());
+    return 1;
+}
+
+// Hardware banner check. The mock controller replays the command/data
+// stream with SSD1306 semantics (column/page addressing, RAM writes, scroll
+// setup and activation) and counts violations: RAM writes into a page
+// while it scrolls, scroll setup while scrolling, activation without
+// setup, a strip that isn't blank outside the window (it would scroll into
+// view), and window RAM that doesn't match the panel the renderer sent,
+// which also catches a page left stale after the scroll stopped.
+class MockSsd1306 {
+private:
+    static constexpr int COLUMNS = 128;
+    static constexpr int PAGES = 8;
+    static constexpr int windowColumn = Panel::CONTROLLER_COLUMN + Panel::X_OFFSET;
+
+    uint8_t ram[PAGES][COLUMNS];
+    bool stale[PAGES][COLUMNS];     // Scrolled, unknown until written again
+    int page, column;
+    bool scrolling, configured;
+    int scrollFirst, scrollLast;
+    uint8_t command[8];
+    int commandLength, commandNeeded;
+
+    static int argumentCount(uint8_t cmd) {
+        switch (cmd) {
+            case 0x81: case 0x20: case 0x8d: case 0xa8: case 0xd3:
+            case 0xd5: case 0xd9: case 0xda: case 0xdb:
+                return 1;
+            case 0x21: case 0x22: case 0xa3:
+                return 2;
+            case 0x29: case 0x2a:
+                return 5;
+            case 0x26: case 0x27:
+                return 6;
+            default:
+                return 0;
+        }
+    }
+
+    void fail(const char *format, int value) {
+        violations++;
+        if (firstViolation.empty()) {
+            char text[96];
+            snprintf(text, sizeof(text), format, value);
+            firstViolation = text;
+        }
+    }
+
+    bool inScroll(int p) const { return scrolling && p >= scrollFirst && p <= scrollLast; }
+
+    void execute() {
+        const uint8_t cmd = command[0];
+        if (cmd < 0x10) {
+            column = (column & 0xf0) | cmd;
+        } else if (cmd < 0x20) {
+            column = (column & 0x0f) | (cmd & 0x0f) << 4;
+        } else if (cmd >= 0xb0 && cmd <= 0xb7) {
+            page = cmd & 7;
+        } else if (cmd == 0x26 || cmd == 0x27 || cmd == 0x29 || cmd == 0x2a || cmd == 0xa3) {
+            if (scrolling) fail("scroll setup 0x%02x while scrolling", cmd);
+            if (cmd == 0x26 || cmd == 0x27) {
+                scrollFirst = command[2] & 7;
+                scrollLast = command[4] & 7;
+                configured = scrollLast >= scrollFirst;
+                if (!configured) fail("scroll end page before start page %d", scrollLast);
+            }
+        } else if (cmd == 0x2f) {
+            if (!configured) fail("scroll activated (0x%02x) without setup", cmd);
+            for (int p = scrollFirst; configured && p <= scrollLast; p++) {
+                for (int c = 0; c < COLUMNS; c++) {
+                    bool visible = c >= windowColumn && c < windowColumn + Panel::WINDOW_WIDTH;
+                    if (!visible && ram[p][c]) {
+                        fail("strip column %d not blank outside the window", c);
+                        break;
+                    }
+                }
+            }
+            scrolling = configured;
+            starts++;
+        } else if (cmd == 0x2e) {
+            if (scrolling) {
+                for (int p = scrollFirst; p <= scrollLast; p++) memset(stale[p], 1, COLUMNS);
+                stops++;
+            }
+            scrolling = false;
+        }
+    }
+
+public:
+    unsigned long starts = 0, stops = 0, violations = 0;
+    std::string firstViolation;
+
+    MockSsd1306()
+        : page(0), column(0), scrolling(false), configured(false), scrollFirst(0), scrollLast(-1),
+          commandLength(0), commandNeeded(0) {
+        memset(ram, 0, sizeof(ram));
+        memset(stale, 0, sizeof(stale));
+    }
+
+    // One byte of the expanded stream (see expandTransaction)
+    void feed(uint32_t token) {
+        const uint8_t value = token & 0xff;
+        if (token & 0x100) {
+            if (inScroll(page)) fail("RAM write to page %d while it scrolls", page);
+            ram[page][column] = value;
+            stale[page][column] = false;
+            if (++column == COLUMNS) {
+                column = 0;
+                page = (page + 1) % PAGES;
+            }
+            return;
+        }
+        if (commandLength == 0) commandNeeded = 1 + argumentCount(value);
+        command[commandLength++] = value;
+        if (commandLength == commandNeeded) {
+            execute();
+            commandLength = 0;
+        }
+    }
+
+    bool isScrolling() const { return scrolling; }
+
+    // Window RAM against what the renderer sent, scrolling pages excepted
+    void compareWindow(const U8G2 &display, unsigned long frame) {
+        const uint8_t *panel = display.getPanelPtr();
+        const int stride = display.getBufferTileWidth() * 8;
+        for (int p = Panel::FIRST_PAGE; p < Panel::FIRST_PAGE + Panel::WINDOW_PAGES; p++) {
+            if (inScroll(p)) continue;
+            bool same = true;
+            for (int c = 0; c < Panel::WINDOW_WIDTH && same; c++) {
+                same = !stale[p][windowColumn + c] &&
+                       ram[p][windowColumn + c] == panel[p * stride + Panel::X_OFFSET + c];
+            }
+            if (!same) {
+                fail("window page differs from the panel at frame %d", (int)frame);
+                return;
+            }
+        }
+    }
+};
+
+struct ScrollRun {
+    unsigned long transactions, bytes, drawCalls;
+    unsigned long starts, stops, violations, scrollingFrames;
+    char firstViolation[96];
+};
+
+static bool runScroll(bool hardware, unsigned long frames, unsigned int seed, ScrollRun &run) {
+    std::vector<uint8_t> result;
+    bool ok = runIsolated(seed, [&](std::vector<uint8_t> &out) {
+        useHardwareScroll = hardware;
+        Wire.setSimulateBusTime(false);
+        Wire.setCapture(true);
+        setup();
+
+        MockSsd1306 controller;
+        ScrollRun totals = {};
+        size_t replayed = 0;
+        std::vector<uint32_t> stream;
+        for (unsigned long frame = 0; frame <= frames; frame++) {
+            // Frame 0 replays setup()
+            if (frame > 0) {
+                u8g2.resetDrawCalls();
+                Wire.resetStats();
+                replayed = 0;
+                runSlot();
+                totals.transactions += Wire.getTransactionCount();
+                totals.bytes += Wire.getByteCount();
+                totals.drawCalls += u8g2.getTotalDrawCalls();
+            }
+            const std::vector<TwoWire::Transaction> &captured = Wire.getCaptured();
+            for (; replayed < captured.size(); replayed++) {
+                stream.clear();
+                expandTransaction(captured[replayed], stream);
+                for (uint32_t token : stream) controller.feed(token);
+            }
+            controller.compareWindow(u8g2, frame);
+            totals.scrollingFrames += controller.isScrolling();
+        }
+        totals.starts = controller.starts;
+        totals.stops = controller.stops;
+        totals.violations = controller.violations;
+        snprintf(totals.firstViolation, sizeof(totals.firstViolation), "%s",
+                 controller.firstViolation.c_str());
+        appendBytes(out, &totals, 1);
+    }, result);
+
+    if (!ok || result.size() != sizeof(run)) return false;
+    takeBytes(result.data(), &run, 1);
+    return true;
+}
+
+static int checkScroll(unsigned long frames, unsigned int seed) {
+    ScrollRun runs[2];
+    if (!runScroll(false, frames, seed, runs[0]) || !runScroll(true, frames, seed, runs[1])) {
+        fprintf(stderr, "scroll run failed\n");
+        return 1;
+    }
+
+    double n = frames ? (double)frames : 1;
+    printf("banner,frames,draw_calls_per_frame,i2c_transactions_per_frame,i2c_bytes_per_frame,"
+           "scrolling_frames,scroll_starts,scroll_stops,violations\n");
+    const char *names[] = {"software", "hardware"};
+    for (int i = 0; i < 2; i++) {
+        const ScrollRun &run = runs[i];
+        printf("%s,%lu,%.1f,%.1f,%.1f,%lu,%lu,%lu,%lu\n", names[i], frames, run.drawCalls / n,
+               run.transactions / n, run.bytes / n, run.scrollingFrames, run.starts, run.stops,
+               run.violations);
+    }
+
+    fflush(stdout);
+    for (int i = 0; i < 2; i++) {
+        if (runs[i].violations) {
+            fprintf(stderr, "%s: %lu violations, first: %s\n", names[i], runs[i].violations,
+                    runs[i].firstViolation);
+            return 1;
+        }
+    }
+    if (runs[0].starts) {
+        fprintf(stderr, "software banner sent scroll commands\n");
+        return 1;
+    }
+    if (!Panel::HORIZONTAL_SCROLL) {
+        fprintf(stderr, "no hardware scroll on this panel, %s\n",
+                runs[1].starts ? "but it was started" : "software fallback only");
+        return runs[1].starts ? 1 : 0;
+    }
+    if (!runs[1].starts) {
+        fprintf(stderr, "hardware scroll never started\n");
+        return 1;
+    }
+    fprintf(stderr, "scroll stream valid: %lu starts, %lu stops over %lu frames\n",
+            runs[1].starts, runs[1].stops, frames);
+    return 0;
+}
+
+// Golden hashes depend on the seed and on the panel (bus time moves the
+// simulated clock), both are in the header line
+static std::string goldenHeader(unsigned int seed) {
+    char header[96];
+    snprintf(header, sizeof(header), "# seed %u panel %dx%d window %d,%d", seed,
+             Panel::BUFFER_WIDTH, Panel::BUFFER_HEIGHT, Panel::X_OFFSET, Panel::Y_OFFSET);
+    return header;
+}
+
+// Header line, then "<case> <frame> <hash>" lines
+static bool readGolden(const char *path, std::string &header, GoldenFrames &golden) {
+    FILE *file = fopen(path, "r");
+    if (!file) return false;
+    char line[128];
+    char name[64];
+    unsigned long frame;
+    unsigned int hash;
+    if (!fgets(line, sizeof(line), file)) {
+        fclose(file);
+        return false;
+    }
+    header = line;
+    header.erase(header.find_last_not_of("\r\n") + 1);
+    while (fscanf(file, "%63s %lu %x", name, &frame, &hash) == 3) {
+        std::vector<uint32_t> &hashes = golden[name];
+        if (hashes.size() <= frame) hashes.resize(frame + 1);
+        hashes[frame] = hash;
+    }
+    fclose(file);
+    return true;
+}
+
+static int runSuite(const char *filter, unsigned long frames, unsigned int seed,
+                    const char *hashOut, const char *hashCheck) {
+    GoldenFrames golden;
+    if (hashCheck) {
+        std::string header;
+        if (!readGolden(hashCheck, header, golden)) {
+            fprintf(stderr, "cannot read %s\n", hashCheck);
+            return 1;
+        }
+        if (header != goldenHeader(seed)) {
+            fprintf(stderr, "%s is for \"%s\", this run is \"%s\"\n", hashCheck,
+                    header.c_str(), goldenHeader(seed).c_str());
+            return 1;
+        }
+    }
+    FILE *hashFile = hashOut ? fopen(hashOut, "w") : nullptr;
+    if (hashOut && !hashFile) {
+        fprintf(stderr, "cannot write %s\n", hashOut);
+        return 1;
+    }
+    if (hashFile) fprintf(hashFile, "%s\n", goldenHeader(seed).c_str());
+
+    std::vector<SuiteCase> cases = suiteCases(filter);
+    unsigned long failed = 0, overBudget = 0;
+    printf("case,frames,rendered_frames,ns_per_frame,median_ns,draw_calls_per_frame,i2c_transactions_per_frame,"
+           "i2c_bytes_per_frame,bus_us_per_frame,golden,first_diff_frame\n");
+
+    for (const SuiteCase &c : cases) {
+        SuiteTotals totals;
+        std::vector<uint32_t> hashes;
+        std::vector<uint64_t> frameNs;
+        if (!runSuiteCase(c, frames, seed, totals, hashes, frameNs)) {
+            fprintf(stderr, "%s: run failed\n", c.name.c_str());
+            return 1;
+        }
+
+        // match, differ (first differing frame), missing (not enough golden frames)
+        const char *status = "-";
+        long firstDiff = -1;
+        if (hashCheck) {
+            const std::vector<uint32_t> &expected = golden[c.name];
+            status = expected.size() < frames ? "missing" : "match";
+            for (unsigned long frame = 0; frame < frames && frame < expected.size(); frame++) {
+                if (expected[frame] != hashes[frame]) {
+                    status = "differ";
+                    firstDiff = frame;
+                    break;
+                }
+            }
+            if (strcmp(status, "match")) failed++;
+        }
+        if (hashFile) {
+            for (unsigned long frame = 0; frame < frames; frame++) {
+                fprintf(hashFile, "%s %lu %08x\n", c.name.c_str(), frame, hashes[frame]);
+            }
+        }
+
+        // Host timing is noisy, the median shrugs off the odd preempted frame
+        double n = frames ? (double)frames : 1;
+        std::sort(frameNs.begin(), frameNs.end());
+        unsigned long long median = frames ? frameNs[frames / 2] : 0;
+        printf("%s,%lu,%llu,%.0f,%llu,%.1f,%.1f,%.1f,%.0f,%s,", c.name.c_str(), frames,
+               (unsigned long long)totals.rendered, totals.ns / n,
+               median, totals.drawCalls / n, totals.transactions / n, totals.bytes / n,
+               totals.busNs / n / 1000, status);
+        if (firstDiff >= 0) printf("%ld", firstDiff);
+        printf("\n");
+
+        // Rendering and the transfer task each get one frame period
+        if (c.from >= 0) {
+            const uint64_t budgetNs = ANIMATION_FRAME_DELAY * 1000000ULL;
+            const bool over = totals.maxNs > budgetNs || totals.maxBusNs > budgetNs;
+            fprintf(stderr, "%s: slowest frame %.0f us render, %.0f us bus, budget %.0f us%s\n",
+                    c.name.c_str(), totals.maxNs / 1000.0, totals.maxBusNs / 1000.0,
+                    budgetNs / 1000.0, over ? " OVER" : "");
+            if (over) overBudget++;
+        }
+    }
+
+    if (hashFile) fclose(hashFile);
+    fflush(stdout);
+    if (hashCheck) fprintf(stderr, "%lu of %zu cases differ from %s\n", failed, cases.size(), hashCheck);
+    if (overBudget) fprintf(stderr, "%lu transitions over the frame budget\n", overBudget);
+    return failed || overBudget ? 1 : 0;
+}
+
+static std::vector<uint32_t> readHashes(const char *path) {
+    std::vector<uint32_t> hashes;
+    FILE *file = fopen(path, "r");
+    if (!file) return hashes;
+    unsigned long frame;
+    unsigned int hash;
+    while (fscanf(file, "%lu %x", &frame, &hash) == 2) hashes.push_back(hash);
+    fclose(file);
+    return hashes;
+}
+
+int main(int argc, char **argv) {
+    unsigned long frames = 200;
+    unsigned int seed = 0;
+    bool csv = false;
+    const char *dumpDir = nullptr;
+    const char *hashOut = nullptr;
+    const char *hashCheck = nullptr;
+    bool mirror = false;
+    bool suite = false;
+    bool i2cCompare = false;
+    bool scrollCheck = false;
+    const char *suiteFilter = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc) frames = strtoul(argv[++i], nullptr, 0);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoul(argv[++i], nullptr, 0);
+        else if (!strcmp(argv[i], "--csv")) csv = true;
+        else if (!strcmp(argv[i], "--quiet")) Serial.setMuted(true);
+        else if (!strcmp(argv[i], "--mirror")) mirror = true;
+        else if (!strcmp(argv[i], "--no-skip")) useRenderSkip = false;
+        else if (!strcmp(argv[i], "--dump") && i + 1 < argc) dumpDir = argv[++i];
+        else if (!strcmp(argv[i], "--hashes") && i + 1 < argc) hashOut = argv[++i];
+        else if (!strcmp(argv[i], "--check") && i + 1 < argc) hashCheck = argv[++i];
+        else if (!strcmp(argv[i], "--bench")) {
+            Serial.setMuted(true);
+            setup();
+            flushSerial();  // Startup log goes nowhere, ahead of the results
+            Serial.setMuted(false);
+            runBenchmarks(i + 1 < argc ? argv[i + 1] : nullptr);
+            return 0;
+        }
+        else if (!strcmp(argv[i], "--suite")) {
+            suite = true;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2)) suiteFilter = argv[++i];
+        }
+        else if (!strcmp(argv[i], "--compare-i2c")) i2cCompare = true;
+        else if (!strcmp(argv[i], "--check-scroll")) scrollCheck = true;
+        else if (!strcmp(argv[i], "--stress-pipeline") && i + 1 < argc) {
+            return stressPipeline(strtoul(argv[i + 1], nullptr, 0));
+        }
+        else {
+            fprintf(stderr, "usage: %s [--frames N] [--seed N] [--csv] [--quiet] [--mirror] [--no-skip] "
+                            "[--dump DIR] [--hashes FILE] [--check FILE] | --bench [FILTER] "
+                            "| --stress-pipeline N | --suite [FILTER] | --compare-i2c "
+                            "| --check-scroll\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (suite) return runSuite(suiteFilter, frames, seed, hashOut, hashCheck);
+    if (i2cCompare) return compareI2c(frames, seed);
+    if (scrollCheck) return checkScroll(frames, seed);
+
+    HostClock::setMicros(0);
+    HostRandom::setAnalogNoise(seed);
+
+    setup();
+    if (mirror) setFrameMirror(true);
+
+    std::vector<uint32_t> expected;
+    if (hashCheck) expected = readHashes(hashCheck);
+    FILE *hashFile = hashOut ? fopen(hashOut, "w") : nullptr;
+
+    if (csv) printf("frame,time_ms,render_ns,draw_calls,i2c_transactions,i2c_bytes,bus_us,hash\n");
+
+    unsigned long mismatches = 0, rendered = 0, unchanged = 0;
+    uint64_t totalNs = 0, totalCalls = 0, totalBytes = 0, totalBusNs = 0;
+
+    for (unsigned long frame = 0; frame < frames; frame++) {
+        unsigned long frameTime = millis();
+        FrameSample sample = renderFrame();
+        uint32_t hash = sample.hash;
+        rendered += sample.rendered;
+        unchanged += sample.unchanged;
+        totalNs += sample.ns;
+        totalCalls += sample.drawCalls;
+        totalBytes += sample.bytes;
+        totalBusNs += sample.busNs;
+
+        if (csv) {
+            printf("%lu,%lu,%llu,%lu,%lu,%lu,%llu,%08x\n", frame, frameTime,
+                   (unsigned long long)sample.ns, sample.drawCalls, sample.transactions,
+                   sample.bytes, (unsigned long long)(sample.busNs / 1000), hash);
+        }
+        if (hashFile) fprintf(hashFile, "%lu %08x\n", frame, hash);
+        if (frame < expected.size() && expected[frame] != hash) {
+            fprintf(stderr, "frame %lu: hash %08x, expected %08x\n", frame, hash, expected[frame]);
+            mismatches++;
+        }
+        if (dumpDir) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frame_%05lu.pbm", dumpDir, frame);
+            if (!writeWindowPbm(u8g2, path)) {
+                fprintf(stderr, "cannot write %s\n", path);
+                return 1;
+            }
+        }
+    }
+
+    if (hashFile) fclose(hashFile);
+
+    if (frames > 0 && !csv) {
+        printf("frames: %lu, %lu rendered (%lu skipped, nothing changed), %lu of those not sent "
+               "(same hash)\n", frames, rendered, frames - rendered, unchanged);
+        printf("render+transfer: %.0f ns/frame (host)\n", (double)totalNs / frames);
+        printf("draw calls: %.1f /frame\n", (double)totalCalls / frames);
+        printf("i2c bytes: %.1f /frame\n", (double)totalBytes / frames);
+        printf("bus time: %.0f us/frame at %lu Hz\n",
+               (double)totalBusNs / frames / 1000, (unsigned long)Wire.getClock());
+    }
+
+    if (hashCheck) {
+        if (expected.size() < frames) {
+            fprintf(stderr, "%s has %zu hashes for %lu frames\n", hashCheck, expected.size(), frames);
+            return 1;
+        }
+        fprintf(stderr, "%lu of %lu frames differ\n", mismatches, frames);
+        return mismatches ? 1 : 0;
+    }
+    return 0;
+}
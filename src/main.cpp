@@ -2,181 +2,319 @@
 #include <U8g2lib.h>
 #include <Wire.h>
 
-// Configuration constants - match original exactly
-const int width = 72;
-const int height = 40;
-const int xOffset = (132 - width) / 2;  // Original used 132, not 128!
-const int yOffset = (64 - height) / 2;
-
-const uint8_t I2C_SDA_PIN = 6;
-const uint8_t I2C_SCL_PIN = 5;
-const uint32_t I2C_FREQUENCY = 400000;
-const uint32_t SERIAL_BAUD_RATE = 115200;
-
-// Animation timing constants
-const unsigned long SCENE_DURATION = 5000;
-const unsigned long DAY_NIGHT_DURATION = 10000;
-const unsigned long ANIMATION_FRAME_DELAY = 50;
+#include "config.h"
+#include "DirtyTiles.h"
+#include "FramePacer.h"
+#include "SpriteAtlas.h"
+#include "BackgroundCache.h"
+#include "FramePipeline.h"
+#include "PixelKernels.h"
+#include "TrigTables.h"
+#include "SceneEngine.h"
+#include "ZoneProfiler.h"
+#include "Logging.h"
+#include "ClipPlayer.h"
+#include "FlyoverClip.h"
+#include "FrameMirror.h"
+#include "I2cTransport.h"
+#include "BannerScroll.h"
+#include "TextStrip.h"
+#include "FrameHash.h"
+#include "AnimationManager.h"
+#include "TweenEngine.h"
+#include "SceneTransition.h"
+#include "Benchmark.h"
 
 // Particle system constants
 const int NUM_SNOWFLAKES = 32;
 
 // Feature flags
-const bool ENABLE_SERIAL_DEBUG = true;
 const bool ANIMATE_STAR = true;
-const bool ENABLE_WEATHER_EFFECTS = true;
-const bool ENABLE_DAY_NIGHT_CYCLE = true;
 
 // Drawing constants
 const int STAR_SIZE = 3;
 const int FLAME_HEIGHT = 4;
-const int SANTA_WIDTH = 12;
-const int SANTA_HEIGHT = 6;
 
-// String constants
-const char* SCROLL_TEXT = "MERRY XMAS!";
+// Static shapes come from the sprite atlas, runtime switch for benchmarks
+bool useSpriteAtlas = ENABLE_SPRITE_ATLAS;
+bool usePixelKernels = ENABLE_PIXEL_KERNELS;
+bool useI2cCoalescing = ENABLE_I2C_COALESCING;  // Read once in setup()
+bool useHardwareScroll = ENABLE_HARDWARE_SCROLL;  // Read once in setup()
+bool useTextStrip = ENABLE_TEXT_STRIP;
+bool useRenderSkip = ENABLE_RENDER_SKIP;
+bool useFrameHash = ENABLE_FRAME_HASH;
+bool useLightSleep = ENABLE_LIGHT_SLEEP;  // Read once in setup()
+bool useTransitions = ENABLE_SCENE_TRANSITIONS;
 
-// Display instance
-U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE, I2C_SDA_PIN, I2C_SCL_PIN);
+// Display instance, the variant comes from the build environment (Panel.h)
+Panel::Display u8g2(U8G2_R0, U8X8_PIN_NONE, I2C_SDA_PIN, I2C_SCL_PIN);
+DirtyTileTransfer<Panel> dirtyTiles(u8g2);
+FramePacer framePacer;
+FrameMirror<Panel> frameMirror;
+BannerScroll<Panel> bannerScroll;
+FrameHash<Panel> frameHash;
+SceneTransition<Panel> sceneTransition;
 
 // Forward declarations
 void drawMoon();
 void drawStar();
 void drawTree();
+void drawTreeLights();
 void drawSnowman();
+void drawSnowmanArms();
 void drawPresents();
 void drawSanta();
 void drawFireplace();
+void drawFlames();
+void drawSceneBackground(uint8_t scene);
 void drawScrollingText();
 void drawSinglePresent(int x, int y, int w, int h);
+void sendFrame(const uint8_t *frame, uint8_t flags);
+
+BackgroundCache<Panel, BACKGROUND_CACHE_SLOTS> backgroundCache(u8g2, drawSceneBackground);
+FramePipeline framePipeline(sendFrame);
 
 // Enums
 enum Weather { SNOW, RAIN, CLEAR };
+constexpr uint8_t WEATHER_COUNT = CLEAR + 1;
+
+const char *const WEATHER_NAMES[WEATHER_COUNT] = {"snow", "rain", "clear"};
 
-// Snow particles structure (restored from original)
-struct Snowflake {
-    int x;
-    int y;
-    int speed;
-} snowflakes[NUM_SNOWFLAKES];
+// Snow and rain share one particle pool, vy holds a flake's fall speed.
+// Flakes never die, they start again at the top.
+typedef BasicParticleSystem<AnimationScalar, NUM_SNOWFLAKES> WeatherParticles;
+WeatherParticles snowflakes;
 
 // Animation state variables (match original exactly)
 Weather currentWeather = SNOW;
 bool isNightTime = true;
-bool santaVisible = false;
-int santaX = xOffset + width + SANTA_WIDTH;  // Match original initialization
+int santaX = X_OFFSET + FRAME_WIDTH + SANTA_WIDTH;  // Match original initialization
 uint8_t currentScene = 0;  // Use uint8_t like original, not enum
 
-// Original animation timing variables (match exactly)
-unsigned long starTimer = 0;
-int starBrightness = 0;
-bool starIncreasing = true;
+// Animation timers, all known to the scheduler so frames where none of
+// them steps can be skipped
+AnimationScheduler animationScheduler;
+
+// Values that move with time rather than in steps: the star pulse, the
+// snowman's arms and Santa's path, started in setup()
+typedef TweenPool<TWEEN_SLOTS> Tweens;
+Tweens tweens;
+Tweens::Handle starTween = -1;
+Tweens::Handle armTween = -1;
+Tweens::Handle santaTween = -1;
 
-unsigned long armTimer = 0;
-int armPosition = 0;
-bool armGoingUp = true;
+// Santa flies from off the left edge until clear of the right one
+constexpr int SANTA_START_X = X_OFFSET - SANTA_WIDTH - 10;
+constexpr int SANTA_END_X = X_OFFSET + FRAME_WIDTH + 11;
 
-int textX = xOffset + width;  // Match original initialization
-unsigned long textTimer = 0;
+int textX = X_OFFSET + FRAME_WIDTH;  // Match original initialization
+AnimationTimer textTimer(TEXT_SCROLL_SPEED);
 
-unsigned long santaTimer = 0;
-unsigned long flameTimer = 0;
+// Banner text, changed over serial ("banner <text>"), and its strip
+char bannerText[BANNER_TEXT_MAX + 1];
+TextStrip<Panel, BANNER_STRIP_COLUMNS> bannerStrip;
+int bannerWidth = 0;
+
+AnimationTimer flameTimer(FLAME_ANIMATION_SPEED);
 uint8_t flamePattern = 0;
 
-unsigned long weatherTimer = 0;
-unsigned long dayNightTimer = 0;
-unsigned long sceneTimer = 0;
+AnimationTimer twinkleTimer(TWINKLE_PERIOD);
+uint8_t twinkleFrame = 0;
+
+AnimationTimer weatherTimer(WEATHER_CHANGE_DURATION);
+AnimationTimer dayNightTimer(DAY_NIGHT_DURATION);
+AnimationTimer sceneTimer(SCENE_DURATION);
 
-// Performance monitoring
-unsigned long frameStartTime = 0;
-unsigned long frameCount = 0;
-float averageFrameTime = 0;
+AnimationTimer *const ANIMATION_TIMERS[] = {
+    &textTimer, &flameTimer, &twinkleTimer, &weatherTimer, &dayNightTimer, &sceneTimer,
+};
+
+// Held scene and weather for the host suite, -1 lets them cycle
+int pinnedScene = -1;
+int pinnedWeather = -1;
 
 // Debug functions
+// Queued, written out in idle time by drainSerial()
 void debugPrint(const char* message) {
     if (ENABLE_SERIAL_DEBUG) {
-        Serial.println(message);
+        LOG_INFO("%s\n", message);
+    }
+}
+
+// Frame pacer idle hook: send the mirror packet in flight, then queued log
+// output, never more than the serial port can take without blocking. Goes
+// in chunks and stops once the slot's slack is used up, so a backlog of
+// output can't push the next frame past its deadline.
+void drainSerial(long remainingUs) {
+    const unsigned long startUs = micros();
+    auto slackLeft = [&]() { return (long)(micros() - startUs) < remainingUs; };
+    
+    int room = Serial.availableForWrite();
+    while (room > 0 && frameMirror.isSending() && slackLeft()) {
+        room -= frameMirror.drain(Serial, min(room, (int)SERIAL_DRAIN_CHUNK));
+    }
+    if (frameMirror.isSending()) return;  // Keep log text out of the packet
+    while (room > 0 && slackLeft()) {
+        const size_t written = logRing.drain(Serial, min(room, (int)SERIAL_DRAIN_CHUNK));
+        if (written == 0) break;
+        room -= written;
+    }
+}
+
+// Send everything queued for the port, blocking: command replies and the
+// host's --bench, which don't wait for the pacer's idle time
+void flushSerial() {
+    while (frameMirror.isSending() || logRing.getPending() > 0) {
+        drainSerial(framePacer.getPeriodUs());
     }
 }
 
+// Command replies go through the log ring like the log does, so they can't
+// land inside a mirror packet or a token record. A long reply (the profiler
+// dump) doesn't fit the ring at once: wait for room instead of dropping.
+struct SerialReply {
+    __attribute__((format(printf, 2, 3)))
+    void printf(const char *format, ...) {
+        char line[LOG_LINE_MAX];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+        if (length < 0) return;
+        length = min(length, (int)sizeof(line) - 1);
+        while (logRing.getFree() < (size_t)length) flushSerial();
+        logRing.write(line, length);
+    }
+} reply;
+
+// Opt-in framebuffer mirror ("mirror on" over serial, --mirror on the host)
+void setFrameMirror(bool enabled) {
+    frameMirror.setEnabled(enabled);
+    frameMirror.resetStats();
+}
+
 void printMemoryUsage() {
     if (!ENABLE_SERIAL_DEBUG) return;
     
     #ifdef ESP32
-    Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
+    LOG_INFO("Free heap: %lu bytes\n", (unsigned long)ESP.getFreeHeap());
     #endif
 }
 
 // Initialize snowflakes (match original exactly)
+// Slots are handed out from 0, so flake i keeps slot i
 void initSnowflakes() {
+    snowflakes.clear();
     for (int i = 0; i < NUM_SNOWFLAKES; i++) {
-        snowflakes[i].x = random(xOffset, xOffset + width);
-        snowflakes[i].y = random(yOffset, yOffset + height);
-        snowflakes[i].speed = random(1, 3);
+        const int x = random(X_OFFSET, X_OFFSET + FRAME_WIDTH);
+        const int y = random(Y_OFFSET, Y_OFFSET + FRAME_HEIGHT);
+        snowflakes.addParticle(AnimationScalar(x), AnimationScalar(y), AnimationScalar(0),
+                               AnimationScalar((int)random(1, 3)));
     }
 }
 
+// Plot all snowflakes in one pass, larger (2x2) flakes for some
+void plotSnowflakes() {
+    if (usePixelKernels) {
+        PixelKernels<Panel> pixels(u8g2);
+        snowflakes.forEachActive([&](uint16_t i) {
+            const int x = scalarToInt(snowflakes.getX(i)), y = scalarToInt(snowflakes.getY(i));
+            if (i % 4 == 0) {
+                pixels.setBlock2x2(x, y);
+            } else {
+                pixels.setPixel(x, y);
+            }
+        });
+        return;
+    }
+
+    snowflakes.forEachActive([&](uint16_t i) {
+        const int x = scalarToInt(snowflakes.getX(i)), y = scalarToInt(snowflakes.getY(i));
+        if (i % 4 == 0) {
+            u8g2.drawPixel(x, y);
+            u8g2.drawPixel(x + 1, y);
+            u8g2.drawPixel(x, y + 1);
+            u8g2.drawPixel(x + 1, y + 1);
+        } else {
+            u8g2.drawPixel(x, y);
+        }
+    });
+}
+
+// Plot rain drops as short vertical lines
+void plotRaindrops() {
+    if (usePixelKernels) {
+        PixelKernels<Panel> pixels(u8g2);
+        snowflakes.forEachActive([&](uint16_t i) {
+            pixels.setVSpan(scalarToInt(snowflakes.getX(i)), scalarToInt(snowflakes.getY(i)), 2);
+        });
+        return;
+    }
+
+    snowflakes.forEachActive([&](uint16_t i) {
+        u8g2.drawVLine(scalarToInt(snowflakes.getX(i)), scalarToInt(snowflakes.getY(i)), 2);
+    });
+}
+
 // Update snow (match original exactly)
 void updateSnow() {
     static uint8_t frame = 0;
     frame++;
     
-    for (int i = 0; i < NUM_SNOWFLAKES; i++) {
-        snowflakes[i].y += snowflakes[i].speed;
+    const AnimationScalar left(X_OFFSET), right(X_OFFSET + FRAME_WIDTH);
+    const AnimationScalar top(Y_OFFSET), bottom(Y_OFFSET + FRAME_HEIGHT);
+    snowflakes.step([&](uint16_t i, AnimationScalar &x, AnimationScalar &y,
+                        AnimationScalar &, AnimationScalar &speed) {
+        y += speed;
         
         // Add slight horizontal movement
         if ((frame + i) % 4 == 0) {
-            snowflakes[i].x += (i % 2) ? 1 : -1;
+            x += AnimationScalar((i % 2) ? 1 : -1);
         }
         
         // Reset snowflake if it goes below or outside the frame
-        if (snowflakes[i].y > yOffset + height || 
-            snowflakes[i].x < xOffset || 
-            snowflakes[i].x > xOffset + width) {
-            snowflakes[i].y = yOffset;
-            snowflakes[i].x = random(xOffset + 2, xOffset + width - 2);
-        }
-        
-        // Draw larger snowflakes (2x2 pixels) for some
-        if (i % 4 == 0) {
-            u8g2.drawPixel(snowflakes[i].x, snowflakes[i].y);
-            u8g2.drawPixel(snowflakes[i].x + 1, snowflakes[i].y);
-            u8g2.drawPixel(snowflakes[i].x, snowflakes[i].y + 1);
-            u8g2.drawPixel(snowflakes[i].x + 1, snowflakes[i].y + 1);
-        } else {
-            u8g2.drawPixel(snowflakes[i].x, snowflakes[i].y);
+        if (y > bottom || x < left || x > right) {
+            y = top;
+            x = AnimationScalar((int)random(X_OFFSET + 2, X_OFFSET + FRAME_WIDTH - 2));
         }
-    }
+        return true;
+    });
+
+    plotSnowflakes();
 }
 
 // Weather system (match original exactly)
 void updateWeather() {
     // Change weather every 10 seconds
-    if (millis() - weatherTimer > 10000) {
-        currentWeather = (Weather)((currentWeather + 1) % 3);
-        weatherTimer = millis();
+    if (pinnedWeather < 0 && weatherTimer.shouldUpdate()) {
+        currentWeather = (Weather)((currentWeather + 1) % WEATHER_COUNT);
     }
     
+    // Snow and rain move every frame
+    if (currentWeather != CLEAR) animationScheduler.wakeNextFrame();
+    
     switch(currentWeather) {
         case SNOW:
             updateSnow();
             break;
         case RAIN:
-            // Draw rain drops as vertical lines
-            for (int i = 0; i < NUM_SNOWFLAKES; i++) {
-                u8g2.drawVLine(snowflakes[i].x, snowflakes[i].y, 2);
-                snowflakes[i].y += 2;
-                if (snowflakes[i].y > yOffset + height) {
-                    snowflakes[i].y = yOffset;
-                    snowflakes[i].x = random(xOffset, xOffset + width);
+            // Drops are drawn where they were, then fall
+            plotRaindrops();
+            snowflakes.step([](uint16_t, AnimationScalar &x, AnimationScalar &y,
+                               AnimationScalar &, AnimationScalar &) {
+                y += AnimationScalar(2);
+                if (y > AnimationScalar(Y_OFFSET + FRAME_HEIGHT)) {
+                    y = AnimationScalar(Y_OFFSET);
+                    x = AnimationScalar((int)random(X_OFFSET, X_OFFSET + FRAME_WIDTH));
                 }
-            }
+                return true;
+            });
             break;
         case CLEAR:
             // Draw stars
             for (int i = 0; i < 5; i++) {
-                int x = xOffset + (width * i / 4);
-                int y = yOffset + 5 + (i % 2) * 3;
+                int x = X_OFFSET + (FRAME_WIDTH * i / 4);
+                int y = Y_OFFSET + 5 + (i % 2) * 3;
                 u8g2.drawPixel(x, y);
             }
             break;
@@ -185,42 +323,43 @@ void updateWeather() {
 
 // Day/night cycle (match original exactly)
 void updateDayNight() {
-    if (millis() - dayNightTimer > DAY_NIGHT_DURATION) {
+    if (dayNightTimer.shouldUpdate()) {
         isNightTime = !isNightTime;
-        dayNightTimer = millis();
     }
     
     if (!isNightTime) {
         // Draw sun instead of moon
-        int sunX = xOffset + 6;
-        int sunY = yOffset + 6;
+        int sunX = X_OFFSET + 6;
+        int sunY = Y_OFFSET + 6;
         u8g2.drawCircle(sunX, sunY, 3);
         // Draw rays
         for (int i = 0; i < 4; i++) {
-            u8g2.drawPixel(sunX + 4*cos(i*PI/2), sunY + 4*sin(i*PI/2));
+            Angle angle = i * QUARTER_TURN;
+            u8g2.drawPixel(sunX + polarX(4, angle), sunY + polarY(4, angle));
         }
     } else {
         drawMoon();
     }
 }
 
+// Frame in which a tween moves to another pixel, for the scheduler
+void wakeForTween(Tweens::Handle tween) {
+    const unsigned long frameMs = max(1UL, framePacer.getPeriodUs() / 1000);
+    animationScheduler.wakeAt(tweens.nextChange(tween, millis(), frameMs,
+                                                max(1UL, RENDER_SKIP_MAX_MS / frameMs)));
+}
+
 // Drawing functions (match original exactly)
 void drawStar() {
-    int starX = xOffset + width/2;
-    int starY = yOffset + 8;  // Position above tree
+    int starX = X_OFFSET + FRAME_WIDTH/2;
+    int starY = Y_OFFSET + 8;  // Position above tree
     
+    // The tween overshoots to STAR_MAX_BRIGHTNESS + 1 so the top level
+    // gets its share of the pulse
+    int starBrightness = 0;
     if (ANIMATE_STAR) {
-        // Update star brightness every 50ms
-        if (millis() - starTimer > 50) {
-            if (starIncreasing) {
-                starBrightness++;
-                if (starBrightness >= 3) starIncreasing = false;
-            } else {
-                starBrightness--;
-                if (starBrightness <= 0) starIncreasing = true;
-            }
-            starTimer = millis();
-        }
+        starBrightness = min(tweens.getInt(starTween), STAR_MAX_BRIGHTNESS);
+        wakeForTween(starTween);
     }
     
     // Draw star with varying size based on brightness
@@ -233,31 +372,22 @@ void drawStar() {
 }
 
 void drawTree() {
-    int treeX = xOffset + width/2;
-    int treeY = yOffset + height - 5;
+    int treeX = X_OFFSET + FRAME_WIDTH/2;
+    int treeY = Y_OFFSET + FRAME_HEIGHT - 5;
     
-    // Draw tree triangles
-    for (int i = 0; i < 3; i++) {
-        int triangleSize = 12 - (i * 3);
-        u8g2.drawTriangle(
-            treeX, treeY - (i * 8) - triangleSize,
-            treeX - triangleSize, treeY - (i * 8),
-            treeX + triangleSize, treeY - (i * 8)
-        );
-        
-        // Add decorations (baubles) to each level
-        int level_y = treeY - (i * 8) - 2;
-        int max_width = triangleSize - 2;
-        u8g2.drawPixel(treeX - max_width/2, level_y);
-        u8g2.drawPixel(treeX + max_width/2, level_y);
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_TREE, treeX, treeY);
+    } else {
+        drawTreeShape(u8g2, treeX, treeY);
     }
-    
-    // Draw trunk
-    u8g2.drawBox(treeX - 2, treeY, 4, 5);
+}
+
+void drawTreeLights() {
+    int treeX = X_OFFSET + FRAME_WIDTH/2;
+    int treeY = Y_OFFSET + FRAME_HEIGHT - 5;
     
     // Add twinkling decorations
-    static uint8_t twinkleFrame = 0;
-    if (millis() % 500 == 0) twinkleFrame++;
+    if (twinkleTimer.shouldUpdate()) twinkleFrame++;
     
     for (int i = 0; i < 3; i++) {
         int y = treeY - (i * 8) - 4;
@@ -269,35 +399,24 @@ void drawTree() {
 }
 
 void drawSnowman() {
-    int snowmanX = xOffset + 12;  // Position on the left side
-    int snowmanY = yOffset + height - 5;  // Near bottom
-    
-    // Bottom circle (larger)
-    u8g2.drawDisc(snowmanX, snowmanY, 4);
-    
-    // Middle circle (smaller)
-    u8g2.drawDisc(snowmanX, snowmanY - 6, 3);
-    
-    // Head (smallest)
-    u8g2.drawDisc(snowmanX, snowmanY - 11, 2);
+    int snowmanX = X_OFFSET + 12;  // Position on the left side
+    int snowmanY = Y_OFFSET + FRAME_HEIGHT - 5;  // Near bottom
     
-    // Eyes (make them empty to stand out against filled head)
-    u8g2.setDrawColor(0);  // Set to black
-    u8g2.drawPixel(snowmanX - 1, snowmanY - 12);
-    u8g2.drawPixel(snowmanX + 1, snowmanY - 12);
-    u8g2.setDrawColor(1);  // Reset to white
-    
-    // Animate arms every 200ms
-    if (millis() - armTimer > 200) {
-        if (armGoingUp) {
-            armPosition++;
-            if (armPosition >= 2) armGoingUp = false;
-        } else {
-            armPosition--;
-            if (armPosition <= -1) armGoingUp = true;
-        }
-        armTimer = millis();
+    // Body, face and scarf
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_SNOWMAN, snowmanX, snowmanY);
+    } else {
+        drawSnowmanShape(u8g2, snowmanX, snowmanY);
     }
+}
+
+void drawSnowmanArms() {
+    int snowmanX = X_OFFSET + 12;
+    int snowmanY = Y_OFFSET + FRAME_HEIGHT - 5;
+    
+    // Arms wave between -1 and 2, same overshoot as the star
+    int armPosition = min(tweens.getInt(armTween), 2);
+    wakeForTween(armTween);
     
     // Draw animated arms
     // Left arm
@@ -306,140 +425,175 @@ void drawSnowman() {
     // Right arm
     u8g2.drawLine(snowmanX + 4, snowmanY - 6, 
                   snowmanX + 6, snowmanY - 8 - armPosition);
-    
-    // Add a small carrot nose
-    u8g2.drawPixel(snowmanX, snowmanY - 11);
-    u8g2.drawPixel(snowmanX + 1, snowmanY - 11);
-    
-    // Add a simple scarf
-    u8g2.drawLine(snowmanX - 2, snowmanY - 8, 
-                  snowmanX + 2, snowmanY - 8);
-    u8g2.drawLine(snowmanX + 2, snowmanY - 8, 
-                  snowmanX + 2, snowmanY - 6);
 }
 
 void drawSinglePresent(int x, int y, int w, int h) {
-    // Box
-    u8g2.drawBox(x - w/2, y - h, w, h);
-    
-    // Ribbon
-    u8g2.drawLine(x, y - h, x, y - h - 2);
-    u8g2.drawLine(x - w/2 + 1, y - h/2, x + w/2 - 1, y - h/2);
-    
-    // Bow
-    u8g2.drawPixel(x - 1, y - h - 2);
-    u8g2.drawPixel(x + 1, y - h - 2);
+    drawPresentShape(u8g2, x, y, w, h);
 }
 
 void drawPresents() {
     // First present (existing one)
-    int presentX = xOffset + width - 12;
-    int presentY = yOffset + height - 6;
-    drawSinglePresent(presentX, presentY, 6, 4);
+    int presentX = X_OFFSET + FRAME_WIDTH - 12;
+    int presentY = Y_OFFSET + FRAME_HEIGHT - 6;
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_PRESENT_LARGE, presentX, presentY);
+    } else {
+        drawSinglePresent(presentX, presentY, 6, 4);
+    }
     
     // Second present (smaller)
     presentX -= 8;
     presentY += 1;
-    drawSinglePresent(presentX, presentY, 4, 3);
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_PRESENT_MEDIUM, presentX, presentY);
+    } else {
+        drawSinglePresent(presentX, presentY, 4, 3);
+    }
     
     // Third present (tiny)
     presentX += 10;
     presentY -= 3;
-    drawSinglePresent(presentX, presentY, 3, 2);
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_PRESENT_SMALL, presentX, presentY);
+    } else {
+        drawSinglePresent(presentX, presentY, 3, 2);
+    }
 }
 
-void drawScrollingText() {
-    u8g2.setFont(u8g2_font_4x6_tf);  // Use a tiny font
+// Rasterize the banner once, it enters from the right edge again. The
+// hardware scroll restarts with the new strip.
+void setBannerText(const char *text) {
+    strncpy(bannerText, text, BANNER_TEXT_MAX);
+    bannerText[BANNER_TEXT_MAX] = '\0';
+    if (!bannerStrip.set(u8g2, u8g2_font_4x6_tf, bannerText)) {
+        LOG_WARN("Banner cut to %d pixels\n", BANNER_STRIP_COLUMNS);
+    }
+    bannerWidth = useTextStrip ? bannerStrip.getWidth() : u8g2.getStrWidth(bannerText);
+    u8g2.setFont(u8g2_font_ncenB10_tr);  // Reset to default font
+    textX = X_OFFSET + FRAME_WIDTH;
+    bannerScroll.restart();
+    animationScheduler.wakeNextFrame();
+}
+
+void updateScrollingText() {
+    bannerScroll.keepAlive();
     
     // Update text position every 100ms
-    if (millis() - textTimer > 100) {
+    if (textTimer.shouldUpdate()) {
         textX--;
-        if (textX < xOffset - 50) textX = xOffset + width;  // Reset position
-        textTimer = millis();
+        if (textX < X_OFFSET - bannerWidth - 6) textX = X_OFFSET + FRAME_WIDTH;  // Reset position
+    }
+}
+
+// 4x6 font: ascent 5 and descent 1 around the baseline
+Bounds scrollingTextBounds() {
+    return {(int16_t)textX, (int16_t)(bannerScroll.baseline() - 6), (int16_t)bannerWidth, 8};
+}
+
+void drawScrollingText() {
+    if (bannerScroll.isScrolling()) return;  // Moved by the panel
+    
+    // Once the whole text is in view the hardware scroll takes over from
+    // here, not mid-transition where the page is a mix of two scenes
+    if (bannerScroll.canStart(textX, bannerWidth) && !sceneTransition.isActive(millis())) {
+        bannerScroll.clearStrip(u8g2);
     }
     
-    u8g2.drawStr(textX, yOffset + height - 2, SCROLL_TEXT);
-    u8g2.setFont(u8g2_font_ncenB10_tr);  // Reset to default font
+    if (useTextStrip) {
+        bannerStrip.draw(u8g2, textX, bannerScroll.baseline());
+    } else {
+        u8g2.setFont(u8g2_font_4x6_tf);  // Use a tiny font
+        u8g2.drawStr(textX, bannerScroll.baseline(), bannerText);
+        u8g2.setFont(u8g2_font_ncenB10_tr);  // Reset to default font
+    }
 }
 
 void drawMoon() {
     // Draw in top left corner
-    int moonX = xOffset + 6;
-    int moonY = yOffset + 6;
+    int moonX = X_OFFSET + 6;
+    int moonY = Y_OFFSET + 6;
     
-    // Full moon
-    u8g2.drawDisc(moonX, moonY, 3);
+    if (useSpriteAtlas) {
+        blitSprite<Panel>(u8g2, SPRITE_MOON, moonX, moonY);
+    } else {
+        drawMoonShape(u8g2, moonX, moonY);
+    }
+}
+
+// From off the left edge, on entry to the santa scene and after each flight
+void startSantaFlight() {
+    tweens.restart(santaTween, SANTA_START_X, SANTA_END_X, SANTA_FLIGHT_MS, EASE_SINE,
+                   TWEEN_ONCE, millis());
+}
+
+void updateSanta() {
+    // A new flight once the last one has left the window, while the scene
+    // is held longer than a flight
+    if (!tweens.isRunning(santaTween)) startSantaFlight();
     
-    // Shadow to make crescent
-    u8g2.setDrawColor(0);
-    u8g2.drawDisc(moonX + 1, moonY, 2);
-    u8g2.setDrawColor(1);
+    santaX = tweens.getInt(santaTween);
+    wakeForTween(santaTween);
+}
+
+// Sleigh, Santa and reindeer span santaX..santaX + 19, santaY - 8..santaY + 1
+Bounds santaBounds() {
+    return {(int16_t)santaX, (int16_t)(Y_OFFSET + 15 - 8), 20, 10};
 }
 
 void drawSanta() {
-    if (santaVisible == false) {
-        santaVisible = true;
-        santaX = xOffset - SANTA_WIDTH - 10;  // Start off-screen on the left
-        santaTimer = millis();
-    }
+    int santaY = Y_OFFSET + 15;
     
-    if (santaVisible) {
-        int santaY = yOffset + 15;
-        santaX++;  // Move right instead of left
-        
-        // Draw sleigh first (now behind)
-        int sleighX = santaX;  // Base position
-        u8g2.drawLine(sleighX, santaY, sleighX + 8, santaY);     // Base
-        u8g2.drawLine(sleighX, santaY, sleighX + 2, santaY - 2); // Front curve
-        u8g2.drawLine(sleighX + 8, santaY, sleighX + 6, santaY - 2); // Back curve
-        
-        // Draw Santa in sleigh
-        u8g2.drawBox(sleighX + 3, santaY - 5, 4, 5);    // Body
-        u8g2.drawDisc(sleighX + 5, santaY - 6, 1);      // Head
-        // Santa's hat
-        u8g2.drawLine(sleighX + 4, santaY - 7, sleighX + 6, santaY - 7);
-        u8g2.drawPixel(sleighX + 6, santaY - 8);
-        
-        // Draw reindeer in front
-        int deerX = sleighX + 10;  // Position reindeer in front of sleigh
-        int deerY = santaY - 2;
-        
-        // Draw harness connecting to sleigh
-        u8g2.drawLine(sleighX + 8, santaY - 1, deerX, deerY);
-        
-        // Reindeer body
-        u8g2.drawLine(deerX, deerY, deerX + 6, deerY);
-        // Legs (animated)
-        int legOffset = ((santaX / 2) % 2) ? 1 : 0;  // Alternate leg positions
-        u8g2.drawLine(deerX + 1, deerY, deerX + 1, deerY + 2 + legOffset);
-        u8g2.drawLine(deerX + 4, deerY, deerX + 4, deerY + 2 + !legOffset);
-        
-        // Reindeer head and antlers
-        u8g2.drawLine(deerX + 6, deerY, deerX + 8, deerY - 2); // Neck
-        u8g2.drawDisc(deerX + 8, deerY - 2, 1);  // Head
-        u8g2.drawPixel(deerX + 9, deerY - 3);    // Nose (Rudolph!)
-        // Antlers
-        u8g2.drawLine(deerX + 8, deerY - 3, deerX + 7, deerY - 4);
-        u8g2.drawLine(deerX + 8, deerY - 3, deerX + 9, deerY - 4);
-        
-        // Reset when completely off screen (right side)
-        if (santaX > xOffset + width + 10) {
-            santaVisible = false;
-        }
-    }
+    // Draw sleigh first (now behind)
+    int sleighX = santaX;  // Base position
+    u8g2.drawLine(sleighX, santaY, sleighX + 8, santaY);     // Base
+    u8g2.drawLine(sleighX, santaY, sleighX + 2, santaY - 2); // Front curve
+    u8g2.drawLine(sleighX + 8, santaY, sleighX + 6, santaY - 2); // Back curve
+    
+    // Draw Santa in sleigh
+    u8g2.drawBox(sleighX + 3, santaY - 5, 4, 5);    // Body
+    u8g2.drawDisc(sleighX + 5, santaY - 6, 1);      // Head
+    // Santa's hat
+    u8g2.drawLine(sleighX + 4, santaY - 7, sleighX + 6, santaY - 7);
+    u8g2.drawPixel(sleighX + 6, santaY - 8);
+    
+    // Draw reindeer in front
+    int deerX = sleighX + 10;  // Position reindeer in front of sleigh
+    int deerY = santaY - 2;
+    
+    // Draw harness connecting to sleigh
+    u8g2.drawLine(sleighX + 8, santaY - 1, deerX, deerY);
+    
+    // Reindeer body
+    u8g2.drawLine(deerX, deerY, deerX + 6, deerY);
+    // Legs (animated)
+    int legOffset = ((santaX / 2) % 2) ? 1 : 0;  // Alternate leg positions
+    u8g2.drawLine(deerX + 1, deerY, deerX + 1, deerY + 2 + legOffset);
+    u8g2.drawLine(deerX + 4, deerY, deerX + 4, deerY + 2 + !legOffset);
+    
+    // Reindeer head and antlers
+    u8g2.drawLine(deerX + 6, deerY, deerX + 8, deerY - 2); // Neck
+    u8g2.drawDisc(deerX + 8, deerY - 2, 1);  // Head
+    u8g2.drawPixel(deerX + 9, deerY - 3);    // Nose (Rudolph!)
+    // Antlers
+    u8g2.drawLine(deerX + 8, deerY - 3, deerX + 7, deerY - 4);
+    u8g2.drawLine(deerX + 8, deerY - 3, deerX + 9, deerY - 4);
 }
 
 void drawFireplace() {
-    int fireX = xOffset + width - 15;
-    int fireY = yOffset + height - 5;
+    int fireX = X_OFFSET + FRAME_WIDTH - 15;
+    int fireY = Y_OFFSET + FRAME_HEIGHT - 5;
     
     // Draw chimney
     u8g2.drawBox(fireX - 4, fireY - 8, 8, 8);
+}
+
+void drawFlames() {
+    int fireX = X_OFFSET + FRAME_WIDTH - 15;
+    int fireY = Y_OFFSET + FRAME_HEIGHT - 5;
     
     // Animate flames every 100ms
-    if (millis() - flameTimer > 100) {
+    if (flameTimer.shouldUpdate()) {
         flamePattern = random(0, 4);
-        flameTimer = millis();
     }
     
     // Draw animated flames
@@ -450,93 +604,737 @@ void drawFireplace() {
     }
 }
 
-// Scene management (match original exactly)
-void updateScene() {
-    if (millis() - sceneTimer > SCENE_DURATION) {
-        currentScene = (currentScene + 1) % 4; // Cycle through 4 scenes
-        sceneTimer = millis();
+// Scene management
+void drawFrameBorder() {
+    u8g2.drawFrame(X_OFFSET, Y_OFFSET, FRAME_WIDTH, FRAME_HEIGHT);
+}
+
+// Objects the scenes are built from, drawn/culled counts are kept per object
+enum SceneObject : uint8_t {
+    OBJECT_FRAME,
+    OBJECT_TREE,
+    OBJECT_TREE_LIGHTS,
+    OBJECT_STAR,
+    OBJECT_SNOWMAN,
+    OBJECT_SNOWMAN_ARMS,
+    OBJECT_PRESENTS,
+    OBJECT_SANTA,
+    OBJECT_FIREPLACE,
+    OBJECT_FLAMES,
+    OBJECT_WEATHER,
+    OBJECT_MOON,
+    OBJECT_TEXT,
+    OBJECT_CLIP,
+    OBJECT_COUNT
+};
+
+// Profiler zones: one per scene object, then the rest of the frame
+enum ProfileZone : uint8_t {
+    ZONE_FRAME = OBJECT_COUNT,  // Whole loop() up to the frame handoff
+    ZONE_BACKGROUND,            // Cache restore or background redraw
+    ZONE_DAY_NIGHT,
+    ZONE_TRANSFER,              // Send, or submit to the transfer task
+    ZONE_MIRROR,                // Framebuffer mirror capture and encode
+    ZONE_PREFETCH,
+    ZONE_TRANSITION,            // Outgoing scene render and compositing
+    ZONE_COUNT
+};
+
+const char *const ZONE_NAMES[ZONE_COUNT] = {
+    "border", "tree", "lights", "star", "snowman", "arms", "presents",
+    "santa", "fireplace", "flames", "weather", "moon", "text", "clip",
+    "frame", "background", "daynight", "transfer", "mirror", "prefetch", "transition"
+};
+
+constexpr Bounds WINDOW_BOUNDS = {X_OFFSET, Y_OFFSET, FRAME_WIDTH, FRAME_HEIGHT};
+
+constexpr Bounds spriteBounds(const Sprite &sprite, int x, int y) {
+    return {(int16_t)(x - sprite.anchorX), (int16_t)(y - sprite.anchorY),
+            (int16_t)sprite.width, (int16_t)sprite.height};
+}
+
+// Shared positions, as used by the drawing functions above
+constexpr int TREE_X = X_OFFSET + FRAME_WIDTH / 2, TREE_Y = Y_OFFSET + FRAME_HEIGHT - 5;
+constexpr int SNOWMAN_X = X_OFFSET + 12, SNOWMAN_Y = Y_OFFSET + FRAME_HEIGHT - 5;
+constexpr int FIRE_X = X_OFFSET + FRAME_WIDTH - 15, FIRE_Y = Y_OFFSET + FRAME_HEIGHT - 5;
+
+constexpr DrawOp FRAME_OP = {OBJECT_FRAME, nullptr, drawFrameBorder, nullptr, WINDOW_BOUNDS};
+constexpr DrawOp PRESENTS_OP = {OBJECT_PRESENTS, nullptr, drawPresents, nullptr,
+                                {X_OFFSET + FRAME_WIDTH - 24, Y_OFFSET + FRAME_HEIGHT - 14, 19, 9}};
+constexpr DrawOp WEATHER_OP = {OBJECT_WEATHER, nullptr, updateWeather, nullptr, WINDOW_BOUNDS};
+constexpr DrawOp TEXT_OP = {OBJECT_TEXT, updateScrollingText, drawScrollingText,
+                            scrollingTextBounds, {}};
+
+constexpr DrawOp CHRISTMAS_BACKGROUND[] = {
+    FRAME_OP,
+    {OBJECT_TREE, nullptr, drawTree, nullptr, spriteBounds(SPRITE_TREE, TREE_X, TREE_Y)},
+    {OBJECT_SNOWMAN, nullptr, drawSnowman, nullptr, spriteBounds(SPRITE_SNOWMAN, SNOWMAN_X, SNOWMAN_Y)},
+    PRESENTS_OP,
+};
+
+constexpr DrawOp CHRISTMAS_FOREGROUND[] = {
+    {OBJECT_TREE_LIGHTS, nullptr, drawTreeLights, nullptr, {TREE_X, TREE_Y - 20, 1, 17}},
+    {OBJECT_STAR, nullptr, drawStar, nullptr, {TREE_X - 3, Y_OFFSET + 8 - 3, 7, 7}},
+    {OBJECT_SNOWMAN_ARMS, nullptr, drawSnowmanArms, nullptr, {SNOWMAN_X - 6, SNOWMAN_Y - 10, 13, 5}},
+    TEXT_OP,
+};
+
+constexpr DrawOp SANTA_BACKGROUND[] = {
+    FRAME_OP,
+};
+
+constexpr DrawOp SANTA_FOREGROUND[] = {
+    {OBJECT_SANTA, updateSanta, drawSanta, santaBounds, {}},
+    WEATHER_OP,
+    TEXT_OP,
+};
+
+constexpr DrawOp FIREPLACE_BACKGROUND[] = {
+    FRAME_OP,
+    {OBJECT_FIREPLACE, nullptr, drawFireplace, nullptr, {FIRE_X - 4, FIRE_Y - 8, 8, 8}},
+    PRESENTS_OP,
+};
+
+constexpr DrawOp FIREPLACE_FOREGROUND[] = {
+    {OBJECT_FLAMES, nullptr, drawFlames, nullptr, {FIRE_X - 1, FIRE_Y - 11, 4, 4}},
+    TEXT_OP,
+};
+
+constexpr DrawOp WEATHER_BACKGROUND[] = {
+    FRAME_OP,
+};
+
+constexpr DrawOp WEATHER_FOREGROUND[] = {
+    WEATHER_OP,
+    // Drawn over the sun, so not part of the background
+    {OBJECT_MOON, nullptr, drawMoon, nullptr, spriteBounds(SPRITE_MOON, X_OFFSET + 6, Y_OFFSET + 6)},
+    TEXT_OP,
+};
+
+// Pre-recorded Santa flyover (tools/clip_encode.cpp), restarted on entry
+ClipPlayer<Panel> flyoverClip(CLIP_FLYOVER, true);
+
+void updateFlyover() {
+    flyoverClip.update(millis());
+    animationScheduler.wakeAt(flyoverClip.getNextFrameMs(millis()));
+}
+void drawFlyover() { flyoverClip.draw(u8g2); }
+
+constexpr DrawOp FLYOVER_BACKGROUND[] = {
+    FRAME_OP,
+};
+
+constexpr DrawOp FLYOVER_FOREGROUND[] = {
+    {OBJECT_CLIP, updateFlyover, drawFlyover, nullptr, WINDOW_BOUNDS},
+};
+
+// Scenes in play order; adding one here is all it takes
+constexpr SceneDefinition SCENES[] = {
+    makeScene("christmas", CHRISTMAS_BACKGROUND, CHRISTMAS_FOREGROUND),
+    makeScene("santa", SANTA_BACKGROUND, SANTA_FOREGROUND),
+    makeScene("fireplace", FIREPLACE_BACKGROUND, FIREPLACE_FOREGROUND),
+    makeScene("weather", WEATHER_BACKGROUND, WEATHER_FOREGROUND),
+    makeScene("flyover", FLYOVER_BACKGROUND, FLYOVER_FOREGROUND),
+};
+
+constexpr uint8_t SCENE_COUNT = sizeof(SCENES) / sizeof(SCENES[0]);
+
+// Histograms the profiler needs: each scene's objects plus the frame zones
+constexpr uint8_t profiledZoneCount() {
+    uint8_t count = 0;
+    for (const SceneDefinition &scene : SCENES) {
+        count += scene.backgroundCount + scene.foregroundCount + (ZONE_COUNT - OBJECT_COUNT);
     }
-    
-    switch(currentScene) {
-        case 0: // Christmas scene
-            drawTree();
-            drawStar();
-            drawSnowman();
-            drawPresents();
-            break;
-        case 1: // Santa scene
-            drawSanta();
-            updateWeather();
-            break;
-        case 2: // Fireplace scene
-            drawFireplace();
-            drawPresents();
-            break;
-        case 3: // Weather scene
-            updateWeather();
-            drawMoon();
-            break;
+    return count;
+}
+
+typedef ZoneProfiler<ZONE_COUNT, SCENE_COUNT, profiledZoneCount()> FrameProfiler;
+FrameProfiler profiler(ZONE_NAMES);
+SceneEngine<OBJECT_COUNT, FrameProfiler> sceneEngine(profiler, SCENES, ZONE_NAMES,
+                                                     X_OFFSET, Y_OFFSET, FRAME_WIDTH, FRAME_HEIGHT);
+
+const char *sceneName(uint8_t scene) { return sceneEngine.getSceneName(scene); }
+uint8_t sceneCount() { return SCENE_COUNT; }
+const char *weatherName(uint8_t weather) { return weather < WEATHER_COUNT ? WEATHER_NAMES[weather] : ""; }
+uint8_t weatherCount() { return WEATHER_COUNT; }
+
+// Hold one scene and weather state (-1 to cycle again), for the host suite
+void pinScene(int scene, int weather) {
+    pinnedScene = scene < (int)SCENE_COUNT ? scene : -1;
+    pinnedWeather = weather < (int)WEATHER_COUNT ? weather : -1;
+    if (pinnedScene >= 0) currentScene = pinnedScene;
+    if (pinnedWeather >= 0) currentWeather = (Weather)pinnedWeather;
+    sceneTimer.reset();
+    weatherTimer.reset();
+    flyoverClip.rewind();
+    startSantaFlight();
+    sceneTransition.cancel();
+}
+
+const char *const TRANSITION_NAMES[TRANSITION_COUNT] = {
+    "wipe-right", "wipe-down", "dissolve", "crossfade"
+};
+
+const char *transitionName(uint8_t kind) { return kind < TRANSITION_COUNT ? TRANSITION_NAMES[kind] : ""; }
+uint8_t transitionCount() { return TRANSITION_COUNT; }
+
+// Each scene is entered with its own kind of transition
+TransitionKind transitionInto(uint8_t scene) { return (TransitionKind)(scene % TRANSITION_COUNT); }
+
+// Blend from one scene into another, started a frame ago so the first
+// frame of the transition already moves
+void beginTransition(uint8_t from, uint8_t to) {
+    const unsigned long frameMs = framePacer.getPeriodUs() / 1000;
+    sceneTransition.begin(from, transitionInto(to), TRANSITION_MS, millis() - frameMs);
+}
+
+// Hold scene `to` as it is entered from `from`, for the host suite
+void pinTransition(int from, int to) {
+    pinScene(to, 0);
+    if (pinnedScene >= 0 && from < (int)SCENE_COUNT) beginTransition(from, to);
+}
+
+void selectScene() {
+    if (pinnedScene >= 0) {
+        sceneTimer.reset();  // Never due, so no prefetch of the next scene either
+        return;
+    }
+    if (sceneTimer.shouldUpdate()) {
+        const uint8_t previousScene = currentScene;
+        currentScene = (currentScene + 1) % SCENE_COUNT;
+        // Only on entry, the flyover and Santa keep going while they blend out
+        if (SCENES[currentScene].foreground == FLYOVER_FOREGROUND) flyoverClip.rewind();
+        if (SCENES[currentScene].foreground == SANTA_FOREGROUND) startSantaFlight();
+        if (useTransitions) beginTransition(previousScene, currentScene);
     }
-    
-    // Always show scrolling text
-    drawScrollingText();
 }
 
-void startPerformanceMonitoring() {
-    frameStartTime = micros();
+// Static part of each scene, cached by backgroundCache
+void drawSceneBackground(uint8_t scene) {
+    // Prefetch renders a scene other than the current one
+    const uint8_t profiledScene = profiler.getScene();
+    profiler.setScene(scene);
+    sceneEngine.drawBackground(scene);
+    profiler.setScene(profiledScene);
 }
 
-void endPerformanceMonitoring() {
-    if (frameStartTime == 0) return;
-    
-    unsigned long frameTime = micros() - frameStartTime;
-    frameCount++;
+// One whole picture of a scene: background, sun or moon, moving parts
+void renderScene(uint8_t scene) {
+    {
+        FrameProfiler::Scope zone(profiler, ZONE_BACKGROUND);
+        if (ENABLE_BACKGROUND_CACHE) {
+            backgroundCache.restore(scene);
+        } else {
+            u8g2.clearBuffer();
+            drawSceneBackground(scene);
+        }
+    }
     
-    // Update average
-    averageFrameTime = (averageFrameTime * (frameCount - 1) + frameTime) / frameCount;
+    {
+        FrameProfiler::Scope zone(profiler, ZONE_DAY_NIGHT);
+        updateDayNight();  // Keep day/night cycle
+    }
     
-    frameStartTime = 0;
+    sceneEngine.drawForeground(scene);  // Each object timed in its own zone
 }
 
 void printPerformanceStats() {
     if (!ENABLE_SERIAL_DEBUG) return;
     
-    Serial.printf("Performance Stats:\n");
-    Serial.printf("  Average frame time: %.2f us (%.1f FPS)\n", 
-                 averageFrameTime, 1000000.0f / averageFrameTime);
-    Serial.printf("  Total frames: %lu\n", frameCount);
+    LOG_INFO("Performance Stats:\n");
+    unsigned long totalFrames = 0;
+    for (uint8_t scene = 0; scene < SCENE_COUNT; scene++) {
+        const FrameProfiler::Histogram &frame = profiler.get(scene, ZONE_FRAME);
+        if (frame.samples == 0) continue;
+        totalFrames += frame.samples;
+        LOG_INFO("  Frame time %s: mean %lu, p95 %lu, p99 %lu, max %lu us, %lu over budget\n",
+                     sceneName(scene), (unsigned long)FrameProfiler::mean(frame),
+                     (unsigned long)FrameProfiler::percentile(frame, 95),
+                     (unsigned long)FrameProfiler::percentile(frame, 99),
+                     (unsigned long)frame.maxUs, (unsigned long)frame.overruns);
+    }
+    LOG_INFO("  Total frames: %lu (\"prof\" for all zones)\n", totalFrames);
+    LOG_INFO("  Target: %u FPS, missed deadlines: %lu/%lu, idle: %.0f%%\n",
+                 framePacer.getTargetFps(), framePacer.getMissedDeadlines(),
+                 framePacer.getFrameCount(), framePacer.getIdleFraction() * 100.0f);
+    if (useRenderSkip) {
+        LOG_INFO("  Skipped frames: %lu (nothing changed), %lu rendered\n",
+                 framePacer.getSkippedFrames(), framePacer.getFrameCount());
+    }
+    framePacer.resetStats();
+    if (useTransitions) {
+        LOG_INFO("  Scene transitions: %lu\n", sceneTransition.getTransitions());
+        sceneTransition.resetStats();
+    }
+    
+    if (ENABLE_DIRTY_TILE_TRANSFER) {
+        LOG_INFO("  Dirty tiles/frame: %.1f of %u\n",
+                     dirtyTiles.getAverageFrameTiles(), dirtyTiles.getWindowTiles());
+        dirtyTiles.resetStats();
+    }
+    
+    if (useFrameHash) {
+        const unsigned long unchanged = frameHash.getUnchanged();
+        if (ENABLE_DIRTY_TILE_TRANSFER) {
+            // The dirty-tile compare would have sent nothing, what an
+            // unchanged frame saves is that compare and the pipeline copy
+            LOG_INFO("  Unchanged frames: %lu of %lu not sent, %lu tile compares and %lu bytes of copy skipped\n",
+                     unchanged, frameHash.getHashed(), unchanged * dirtyTiles.getWindowTiles(),
+                     framePipeline.isRunning() ? unchanged * FRAME_BUFFER_BYTES : 0);
+        } else {
+            // Whole buffers are sent, each unchanged one would have taken
+            // what the average sent frame took
+            unsigned long sentFrames = I2cTransport::getFrames();
+            float savedUs = sentFrames > 0
+                ? (float)I2cTransport::getBusUs() / sentFrames * unchanged : 0;
+            LOG_INFO("  Unchanged frames: %lu of %lu not sent, %.0f us bus saved\n",
+                     unchanged, frameHash.getHashed(), savedUs);
+        }
+        frameHash.resetStats();
+    }
+    
+    unsigned long i2cFrames = I2cTransport::getFrames();
+    if (i2cFrames > 0) {
+        float busUs = (float)I2cTransport::getBusUs() / i2cFrames;
+        LOG_INFO("  I2C/frame: %.1f transactions, %.0f bytes, %.0f us bus (%.0f%% of frame) at %lu Hz%s\n",
+                     (float)I2cTransport::getTransactions() / i2cFrames,
+                     (float)I2cTransport::getBusBytes() / i2cFrames, busUs,
+                     busUs * 100.0f / framePacer.getPeriodUs(), (unsigned long)I2C_BUS_CLOCK,
+                     useI2cCoalescing ? ", coalesced" : "");
+        I2cTransport::resetStats();
+    }
+    
+    if (bannerScroll.isEnabled()) {
+        LOG_INFO("  Banner: %s scroll, %lu hardware starts\n",
+                 bannerScroll.isScrolling() ? "hardware" : "software", bannerScroll.getStarts());
+        bannerScroll.resetStats();
+    }
+    
+    if (framePipeline.isRunning()) {
+        LOG_INFO("  Pipeline: %lu frames, %lu waited for transfer, %.0f us/transfer\n",
+                     framePipeline.getSubmitted(), framePipeline.getBlockedSubmits(),
+                     framePipeline.getAverageTransferUs());
+        framePipeline.resetStats();
+    }
+    
+    LOG_INFO("  Objects drawn/culled:");
+    for (uint8_t object = 0; object < OBJECT_COUNT; object++) {
+        unsigned long drawn = sceneEngine.getDrawn(object), culled = sceneEngine.getCulled(object);
+        if (drawn == 0 && culled == 0) continue;
+        LOG_INFO(" %s %lu/%lu", sceneEngine.getObjectName(object), drawn, culled);
+    }
+    LOG_INFO("\n");
+    sceneEngine.resetStats();
+    
+    if (frameMirror.isEnabled()) {
+        unsigned long sent = frameMirror.getSentFrames();
+        LOG_INFO("  Mirror: %lu frames sent, %lu dropped, %lu keyframes, %lu bytes/frame\n",
+                 sent, frameMirror.getDroppedFrames(), frameMirror.getKeyframes(),
+                 sent ? frameMirror.getSentBytes() / sent : 0);
+        frameMirror.resetStats();
+    }
+    
+    if (ENABLE_BACKGROUND_CACHE) {
+        LOG_INFO("  Background cache: %lu hits, %lu misses, %lu prefetched\n",
+                     backgroundCache.getHits(), backgroundCache.getMisses(),
+                     backgroundCache.getPrefetches());
+        backgroundCache.resetStats();
+    }
+}
+
+// Send one rendered buffer, called from the transfer task when pipelined.
+// flags is the banner command for this frame: a stopped scroll hands the
+// banner page back before the tiles go out, a started one takes it over.
+void sendFrame(const uint8_t *frame, uint8_t flags) {
+    if (flags == BannerScroll<Panel>::STOP) {
+        bannerScroll.stop(u8g2.getU8x8());
+        dirtyTiles.releasePage();
+    } else if (flags == BannerScroll<Panel>::START) {
+        dirtyTiles.holdPage(BannerScroll<Panel>::PAGE);
+    }
+    
+    if (ENABLE_DIRTY_TILE_TRANSFER) {
+        dirtyTiles.send(frame);
+    } else {
+        for (uint8_t ty = 0; ty < Panel::BUFFER_TILE_HEIGHT; ty++) {
+            if (ty == BannerScroll<Panel>::PAGE && bannerScroll.isOnPanel()) continue;
+            u8x8_DrawTile(u8g2.getU8x8(), 0, ty, Panel::BUFFER_TILE_WIDTH,
+                          (uint8_t *)frame + ty * Panel::BUFFER_WIDTH);
+        }
+    }
+    
+    if (flags == BannerScroll<Panel>::START) bannerScroll.start(u8g2.getU8x8(), frame);
+    I2cTransport::frameSent();
+}
+
+// Scene 0 frame, for comparing primitive, atlas and cached rendering
+void drawChristmasForeground() {
+    drawMoon();
+    drawTreeLights();
+    drawStar();
+    drawSnowmanArms();
+    updateScrollingText();
+    drawScrollingText();
+}
+
+void benchScene0Primitives() {
+    useSpriteAtlas = false;
+    u8g2.clearBuffer();
+    drawSceneBackground(0);
+    drawChristmasForeground();
+    useSpriteAtlas = ENABLE_SPRITE_ATLAS;
+}
+
+void benchScene0Atlas() {
+    useSpriteAtlas = true;
+    u8g2.clearBuffer();
+    drawSceneBackground(0);
+    drawChristmasForeground();
+    useSpriteAtlas = ENABLE_SPRITE_ATLAS;
+}
+
+void benchScene0Cached() {
+    backgroundCache.restore(0);
+    drawChristmasForeground();
+}
+
+// Particle and tween update cost, float against fixed point
+BasicParticleSystem<float, MAX_PARTICLES> floatBenchParticles;
+BasicParticleSystem<Q16_16, MAX_PARTICLES> fixedBenchParticles;
+BasicAnimationValue<float> floatBenchTweens[MAX_PARTICLES];
+BasicAnimationValue<Q16_16> fixedBenchTweens[MAX_PARTICLES];
+TweenPool<MAX_PARTICLES> benchTweenPool;
+
+template <typename Scalar, uint16_t CAPACITY>
+void benchParticleUpdate(BasicParticleSystem<Scalar, CAPACITY> &system) {
+    // Respawn the pool before it drains, particles live for 100 updates
+    if (system.getActiveCount() < CAPACITY / 2) {
+        system.clear();
+        for (int i = 0; i < (int)CAPACITY; i++) {
+            system.addParticle(toScalar<Scalar>(X_OFFSET + 10 + i % 50),
+                               toScalar<Scalar>(Y_OFFSET + 5 + i % 30),
+                               toScalar<Scalar>(0.1f), toScalar<Scalar>(0.05f));
+        }
+    }
+    system.update();
+}
+
+template <typename Scalar>
+void benchTweenUpdate(BasicAnimationValue<Scalar> *values) {
+    for (int i = 0; i < MAX_PARTICLES; i++) {
+        if (!values[i].isAnimating()) {
+            values[i].animateTo(values[i].getValue() < Scalar(20) ? Scalar(40 + i) : Scalar(i),
+                                toScalar<Scalar>(2.0f));
+        }
+        values[i].update();
+    }
+}
+
+void benchParticlesFloat() { benchParticleUpdate(floatBenchParticles); }
+void benchParticlesFixed() { benchParticleUpdate(fixedBenchParticles); }
+
+#ifndef ESP32
+// Host-only stress run of the same pool code at 16k particles
+BasicParticleSystem<Q16_16, 16384> stressParticles;
+void benchParticlesStress() { benchParticleUpdate(stressParticles); }
+#endif
+void benchTweensFloat() { benchTweenUpdate(floatBenchTweens); }
+void benchTweensFixed() { benchTweenUpdate(fixedBenchTweens); }
+
+// The same number of values as one pool, all curves, one frame per call
+void benchTweensPool() {
+    static unsigned long benchMs = 0;
+    if (benchTweenPool.getActiveCount() == 0) {
+        for (int i = 0; i < MAX_PARTICLES; i++) {
+            benchTweenPool.start(i, 40 + i, 500 + 50 * i, (Easing)(i % EASING_COUNT),
+                                 TWEEN_PING_PONG, benchMs);
+        }
+    }
+    benchMs += ANIMATION_FRAME_DELAY;
+    benchTweenPool.update(benchMs);
+}
+
+// Weather plotting, U8g2 calls against the direct buffer kernels
+void benchWeather(bool kernels) {
+    usePixelKernels = kernels;
+    plotSnowflakes();
+    plotRaindrops();
+    usePixelKernels = ENABLE_PIXEL_KERNELS;
+}
+
+void benchWeatherU8g2() { benchWeather(false); }
+void benchWeatherKernels() { benchWeather(true); }
+
+// One sin/cos pair per item, libm double precision against the table
+volatile int trigSink;
+const int TRIG_BENCH_ANGLES = 64;
+
+void benchTrigLibm() {
+    int sum = 0;
+    for (int i = 0; i < TRIG_BENCH_ANGLES; i++) {
+        double radians = i * (2 * PI / TRIG_BENCH_ANGLES);
+        sum += 16 * cos(radians) + 16 * sin(radians);
+    }
+    trigSink = sum;
+}
+
+void benchTrigTable() {
+    int sum = 0;
+    for (int i = 0; i < TRIG_BENCH_ANGLES; i++) {
+        Angle angle = i * (ANGLE_STEPS / TRIG_BENCH_ANGLES);
+        sum += polarX(16, angle) + polarY(16, angle);
+    }
+    trigSink = sum;
+}
+
+// One clip frame: decode the next delta and OR it into the window
+ClipPlayer<Panel> benchClip(CLIP_FLYOVER, true);
+unsigned long benchClipMs = 0;
+
+void benchClipFrame() {
+    benchClipMs += ClipFormat::getFrameMs(CLIP_FLYOVER);
+    benchClip.update(benchClipMs);
+    benchClip.draw(u8g2);
+}
+
+// Banner text, drawn by U8g2's font code against blitted from its strip
+TextStrip<Panel, BANNER_STRIP_COLUMNS> benchStrip;
+
+void benchTextU8g2() {
+    u8g2.setFont(u8g2_font_4x6_tf);
+    u8g2.drawStr(X_OFFSET + 10, Y_OFFSET + FRAME_HEIGHT - 2, bannerText);
+    u8g2.setFont(u8g2_font_ncenB10_tr);
+}
+
+void benchTextStrip() {
+    bannerStrip.draw(u8g2, X_OFFSET + 10, Y_OFFSET + FRAME_HEIGHT - 2);
+}
+
+void benchTextRasterize() {
+    benchStrip.set(u8g2, u8g2_font_4x6_tf, bannerText);
+}
+
+// An unchanged frame: what the hash check costs, against the pipeline copy
+// and dirty-tile compare it saves (the first call sends the window once)
+DirtyTileTransfer<Panel> benchTiles(u8g2);
+uint8_t benchFrameCopy[FRAME_BUFFER_BYTES];
+volatile uint32_t hashSink;
+
+void benchHashWindow() {
+    hashSink = FrameHash<Panel>::compute(u8g2.getBufferPtr());
+}
+
+void benchSendUnchanged() {
+    memcpy(benchFrameCopy, u8g2.getBufferPtr(), FRAME_BUFFER_BYTES);
+    benchTiles.send(benchFrameCopy);
+}
+
+// Compositing alone, half way through, against whatever the buffer holds
+template <TransitionKind KIND>
+void benchComposite() {
+    SceneTransition<Panel>::composite(u8g2.getBufferPtr(), sceneTransition.getLayer(), KIND,
+                                      PROGRESS_ONE / 2);
+}
+
+// A whole transition frame, christmas into santa: both scenes rendered and
+// composited, to hold against the frame budget
+void benchTransitionFrame() {
+    renderScene(0);
+    sceneTransition.capture(u8g2.getBufferPtr());
+    renderScene(1);
+    SceneTransition<Panel>::composite(u8g2.getBufferPtr(), sceneTransition.getLayer(),
+                                      TRANSITION_CROSSFADE, PROGRESS_ONE / 2);
+}
+
+const Benchmark::Case BENCHMARKS[] = {
+    {"scene0/primitives", benchScene0Primitives, 1000},
+    {"scene0/atlas", benchScene0Atlas, 1000},
+    {"scene0/cached", benchScene0Cached, 1000},
+    {"particle/float", benchParticlesFloat, 2000, MAX_PARTICLES},
+    {"particle/fixed", benchParticlesFixed, 2000, MAX_PARTICLES},
+#ifndef ESP32
+    {"particle/stress-16k", benchParticlesStress, 200, 16384},
+#endif
+    {"tween/float", benchTweensFloat, 2000, MAX_PARTICLES},
+    {"tween/fixed", benchTweensFixed, 2000, MAX_PARTICLES},
+    {"tween/pool", benchTweensPool, 2000, MAX_PARTICLES},
+    {"weather/u8g2", benchWeatherU8g2, 2000, NUM_SNOWFLAKES * 2},
+    {"weather/kernels", benchWeatherKernels, 2000, NUM_SNOWFLAKES * 2},
+    {"trig/libm", benchTrigLibm, 1000, TRIG_BENCH_ANGLES},
+    {"trig/table", benchTrigTable, 1000, TRIG_BENCH_ANGLES},
+    {"clip/frame", benchClipFrame, 2000},
+    {"text/u8g2", benchTextU8g2, 2000},
+    {"text/strip", benchTextStrip, 2000},
+    {"text/rasterize", benchTextRasterize, 500},
+    {"hash/window", benchHashWindow, 2000},
+    {"send/unchanged", benchSendUnchanged, 2000},
+    {"transition/wipe-right", benchComposite<TRANSITION_WIPE_RIGHT>, 2000},
+    {"transition/wipe-down", benchComposite<TRANSITION_WIPE_DOWN>, 2000},
+    {"transition/dissolve", benchComposite<TRANSITION_DISSOLVE>, 2000},
+    {"transition/crossfade", benchComposite<TRANSITION_CROSSFADE>, 2000},
+    {"transition/frame", benchTransitionFrame, 500},
+};
+
+void runBenchmarks(const char* filter) {
+    // send/unchanged talks to the panel, keep it off the transfer task's bus
+    if (framePipeline.isRunning()) framePipeline.flush();
+    Benchmark::runAll(reply, BENCHMARKS, sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]), filter);
+    flushSerial();
+}
+
+// Serial commands, one per line:
+//   "fps <n>"        set the target frame rate
+//   "bench [filter]" run the micro benchmarks
+//   "prof"           dump the zone profiler histograms
+//   "prof reset"     clear them
+//   "mirror on|off"  stream the window for tools/mirror_view.py
+//   "banner <text>"  change the scrolling banner
+void handleSerialCommands() {
+    static char line[16 + BANNER_TEXT_MAX];
+    static uint8_t length = 0;
+    
+    while (Serial.available() > 0) {
+        char c = Serial.read();
+        if (c != '\n' && c != '\r') {
+            if (length < sizeof(line) - 1) line[length++] = c;
+            continue;
+        }
+        line[length] = '\0';
+        length = 0;
+        
+        int fps;
+        if (sscanf(line, "fps %d", &fps) == 1 && fps > 0) {
+            framePacer.setTargetFps(min(fps, (int)MAX_TARGET_FPS));
+            profiler.setBudget(ZONE_FRAME, framePacer.getPeriodUs());
+            LOG_INFO("Target FPS: %u\n", framePacer.getTargetFps());
+        } else if (strncmp(line, "bench", 5) == 0) {
+            runBenchmarks(line[5] == ' ' ? line + 6 : nullptr);
+            framePacer.begin();  // Don't count the benchmark as missed frames
+            profiler.reset();    // Nor its draw calls as scene samples
+        } else if (strcmp(line, "prof") == 0) {
+            profiler.dump(reply, sceneName);
+            flushSerial();
+        } else if (strcmp(line, "prof reset") == 0) {
+            profiler.reset();
+            LOG_INFO("Profiler reset\n");
+        } else if (strcmp(line, "mirror on") == 0 || strcmp(line, "mirror off") == 0) {
+            setFrameMirror(line[8] == 'n');
+            LOG_INFO("Mirror %s\n", frameMirror.isEnabled() ? "on" : "off");
+        } else if (strncmp(line, "banner ", 7) == 0) {
+            setBannerText(line + 7);
+            LOG_INFO("Banner: %s\n", bannerText);
+        }
+    }
 }
 
 void setup() {
     Serial.begin(115200);
     delay(1000);
     
+    // Transport and clock before begin(), it brings up Wire
+    I2cTransport::attach(u8g2, useI2cCoalescing);
+    u8g2.setBusClock(I2C_BUS_CLOCK);
     u8g2.begin();
     u8g2.setContrast(255);
-    u8g2.setBusClock(400000);
+    
+    bannerScroll.setEnabled(useHardwareScroll);
+    if (useHardwareScroll && !bannerScroll.isEnabled()) {
+        LOG_WARN("No hardware scroll on this panel, banner stays in software\n");
+    }
+    setBannerText(SCROLL_TEXT);
     
     // Initialize random seed
     randomSeed(analogRead(0));
     initSnowflakes();
     
-    Serial.println("Christmas Demo initialized");
+    LOG_INFO("Christmas Demo initialized\n");
     printMemoryUsage();
-}
-
-void loop() {
-    startPerformanceMonitoring();
     
-    u8g2.clearBuffer();
+    // The host build keeps transfers inline so its simulated clock stays
+    // deterministic, the handoff is exercised there by --stress-pipeline
+    #ifdef ESP32
+    if (ENABLE_TRANSFER_PIPELINE && !framePipeline.begin()) {
+        LOG_ERROR("Transfer task failed to start, sending inline\n");
+    }
+    #endif
     
-    // Draw frame (match original exactly)
-    u8g2.drawFrame(xOffset, yOffset, width, height);
+    for (AnimationTimer *timer : ANIMATION_TIMERS) {
+        if (!animationScheduler.add(*timer)) LOG_ERROR("ANIMATION_TIMER_SLOTS too small\n");
+    }
     
-    updateDayNight();  // Keep day/night cycle
-    updateScene();     // Draw current scene
+    starTween = tweens.start(0, STAR_MAX_BRIGHTNESS + 1, STAR_PULSE_MS, EASE_SINE,
+                             TWEEN_PING_PONG, millis());
+    armTween = tweens.start(-1, 3, ARM_WAVE_MS, EASE_QUAD, TWEEN_PING_PONG, millis());
+    // Santa's flight starts over on entry to his scene, see selectScene()
+    santaTween = tweens.start(SANTA_START_X, SANTA_END_X, SANTA_FLIGHT_MS, EASE_SINE,
+                              TWEEN_ONCE, millis());
     
-    u8g2.sendBuffer();
+    profiler.setBudget(ZONE_FRAME, framePacer.getPeriodUs());
+    if (ENABLE_FRAME_MIRROR) setFrameMirror(true);
+    framePacer.setIdleTask(drainSerial);
+    framePacer.setLightSleep(useLightSleep);
+    framePacer.begin();
+}
+
+void loop() {
+    animationScheduler.beginFrame();
+    tweens.update(millis());
+    selectScene();
+    profiler.setScene(currentScene);
+    bannerScroll.beginFrame();
     
-    endPerformanceMonitoring();
+    {
+        FrameProfiler::Scope frameZone(profiler, ZONE_FRAME);
+        
+        // During a transition the outgoing scene keeps running, rendered
+        // first and set aside as a layer
+        const bool blending = useTransitions && sceneTransition.isActive(millis());
+        if (blending) {
+            // Its draw calls and zones count against the outgoing scene,
+            // as the prefetch does in drawSceneBackground()
+            profiler.setScene(sceneTransition.getOutgoingScene());
+            {
+                FrameProfiler::Scope zone(profiler, ZONE_TRANSITION);
+                renderScene(sceneTransition.getOutgoingScene());
+                sceneTransition.capture(u8g2.getBufferPtr());
+            }
+            profiler.setScene(currentScene);
+        }
+        
+        renderScene(currentScene);
+        
+        if (blending) {
+            FrameProfiler::Scope zone(profiler, ZONE_TRANSITION);
+            sceneTransition.composite(u8g2.getBufferPtr(), millis());
+            animationScheduler.wakeNextFrame();
+        }
+        
+        if (frameMirror.isEnabled()) {
+            FrameProfiler::Scope zone(profiler, ZONE_MIRROR);
+            frameMirror.capture(u8g2.getBufferPtr(), millis());
+        }
+        
+        FrameProfiler::Scope zone(profiler, ZONE_TRANSFER);
+        const uint8_t bannerCommand = bannerScroll.endFrame();
+        if (useFrameHash &&
+            !frameHash.changed(u8g2.getBufferPtr(), bannerCommand != BannerScroll<Panel>::NONE)) {
+            // Same picture as the last frame sent, nothing to transfer
+        } else if (framePipeline.isRunning()) {
+            framePipeline.submit(u8g2.getBufferPtr(), bannerCommand);
+        } else {
+            sendFrame(u8g2.getBufferPtr(), bannerCommand);
+        }
+    }
+    
+    // Render the next scene's background while we would sleep anyway, the
+    // buffer has been sent (or copied to the pipeline) so it is free to use
+    // as scratch
+    if (ENABLE_BACKGROUND_CACHE &&
+        sceneTimer.getElapsed() > SCENE_DURATION - BACKGROUND_PREFETCH_LEAD &&
+        framePacer.getRemainingUs() > BACKGROUND_PREFETCH_MIN_IDLE_US) {
+        FrameProfiler::Scope zone(profiler, ZONE_PREFETCH);
+        backgroundCache.prefetch((currentScene + 1) % SCENE_COUNT, currentScene);
+    }
     
     // Print performance stats every 10 seconds
     static unsigned long lastStatsTime = 0;
@@ -545,5 +1343,14 @@ void loop() {
         lastStatsTime = millis();
     }
     
-    delay(50);
+    handleSerialCommands();
+    
+    // Nothing on screen changes before the scheduler's next deadline, sleep
+    // through the frames until then instead of resending the same picture
+    if (useRenderSkip) {
+        if (useLightSleep && framePipeline.isRunning()) framePipeline.flush();
+        framePacer.waitForFrameAt(animationScheduler.nextDue(millis(), RENDER_SKIP_MAX_MS));
+    } else {
+        framePacer.waitForNextFrame();
+    }
 } 
\ No newline at end of file
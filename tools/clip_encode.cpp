@@ -0,0 +1,184 @@
+// Clip encoder: PBM frame sequence -> clip header for ClipPlayer
+//
+//   g++ -std=gnu++17 -O2 -Isrc/host -Isrc tools/clip_encode.cpp -o clip_encode
+//   ./clip_encode [--name NAME] [--frame-ms N] [--keyframe-every N] OUT.h FRAME.pbm...
+//
+// Frames are 72x40 PBM images (P1 or P4, e.g. from the host build's
+// --dump), in play order. Each frame is stored as a keyframe or as an XOR
+// delta against the previous one, whichever is smaller; --keyframe-every
+// forces a keyframe every N frames. Every frame is decoded again with the
+// firmware's ClipFormat::decodeFrame and compared with its source, and the
+// per-frame size and decode time are reported together with the overall
+// compression ratio.
+
+#include <Arduino.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "ClipPlayer.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool readToken(FILE *file, std::string &token) {
+    token.clear();
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        if (c == '#') {
+            while ((c = fgetc(file)) != EOF && c != '\n') {}
+        } else if (!isspace(c)) {
+            token += (char)c;
+            break;
+        }
+    }
+    while ((c = fgetc(file)) != EOF && !isspace(c)) token += (char)c;
+    return !token.empty();
+}
+
+// PBM to window page layout, false with a message on error
+static bool readPbm(const char *path, Bytes &frame) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    std::string magic, width, height;
+    bool ok = readToken(file, magic) && readToken(file, width) && readToken(file, height) &&
+              (magic == "P1" || magic == "P4");
+    if (!ok || atoi(width.c_str()) != ClipFormat::WIDTH || atoi(height.c_str()) != ClipFormat::HEIGHT) {
+        fprintf(stderr, "%s: need a %dx%d P1/P4 PBM\n", path, ClipFormat::WIDTH, ClipFormat::HEIGHT);
+        fclose(file);
+        return false;
+    }
+
+    frame.assign(ClipFormat::FRAME_BYTES, 0);
+    for (int y = 0; y < ClipFormat::HEIGHT && ok; y++) {
+        uint8_t row[(ClipFormat::WIDTH + 7) / 8] = {0};
+        if (magic == "P4") {
+            ok = fread(row, 1, sizeof(row), file) == sizeof(row);
+        } else {
+            for (int x = 0; x < ClipFormat::WIDTH && ok; x++) {
+                int c;
+                while ((c = fgetc(file)) != EOF && isspace(c)) {}
+                ok = c == '0' || c == '1';
+                if (c == '1') row[x / 8] |= 0x80 >> (x & 7);
+            }
+        }
+        for (int x = 0; x < ClipFormat::WIDTH && ok; x++) {
+            if (row[x / 8] & (0x80 >> (x & 7))) {
+                frame[(y / 8) * ClipFormat::WIDTH + x] |= 1 << (y & 7);
+            }
+        }
+    }
+    fclose(file);
+    if (!ok) fprintf(stderr, "%s: truncated\n", path);
+    return ok;
+}
+
+static Bytes encodeRecord(const Bytes &frame, const Bytes *previous) {
+    Bytes out(ClipFormat::MAX_RECORD_BYTES);
+    out.resize(ClipFormat::encodeFrame(frame.data(), previous ? previous->data() : nullptr, out.data()));
+    return out;
+}
+
+static double decodeNs(const uint8_t *record, const Bytes &previous) {
+    const int repeats = 2000;
+    uint8_t frame[ClipFormat::FRAME_BYTES];
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        memcpy(frame, previous.data(), sizeof(frame));
+        ClipFormat::decodeFrame(record, frame);
+        asm volatile("" : : "r"(frame) : "memory");
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / repeats;
+}
+
+static bool writeHeader(const char *path, const std::string &name, const Bytes &clip, size_t frames) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+
+    std::string guard;
+    for (char c : name) guard += (char)toupper((unsigned char)c);
+    fprintf(file, "#ifndef %s_CLIP_H\n#define %s_CLIP_H\n\n", guard.c_str(), guard.c_str());
+    fprintf(file, "#include \"ClipPlayer.h\"\n\n");
+    fprintf(file, "// Generated by tools/clip_encode.cpp from %zu frames, do not edit\n", frames);
+    fprintf(file, "inline constexpr uint8_t CLIP_%s_DATA[] PROGMEM = {", guard.c_str());
+    for (size_t i = 0; i < clip.size(); i++) {
+        fprintf(file, "%s0x%02x,", i % 16 ? " " : "\n    ", clip[i]);
+    }
+    fprintf(file, "\n};\n\n");
+    fprintf(file, "inline constexpr Clip CLIP_%s = {CLIP_%s_DATA, sizeof(CLIP_%s_DATA)};\n\n",
+            guard.c_str(), guard.c_str(), guard.c_str());
+    fprintf(file, "#endif // %s_CLIP_H\n", guard.c_str());
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    std::string name = "clip";
+    unsigned long frameMs = 50;
+    unsigned long keyframeEvery = 0;
+    int arg = 1;
+    for (; arg < argc && !strncmp(argv[arg], "--", 2); arg++) {
+        if (!strcmp(argv[arg], "--name") && arg + 1 < argc) name = argv[++arg];
+        else if (!strcmp(argv[arg], "--frame-ms") && arg + 1 < argc) frameMs = strtoul(argv[++arg], nullptr, 0);
+        else if (!strcmp(argv[arg], "--keyframe-every") && arg + 1 < argc) keyframeEvery = strtoul(argv[++arg], nullptr, 0);
+        else break;
+    }
+    if (argc - arg < 2 || frameMs == 0 || frameMs > 0xFFFF || argc - arg - 1 > 0xFFFF) {
+        fprintf(stderr, "usage: %s [--name NAME] [--frame-ms N] [--keyframe-every N] OUT.h FRAME.pbm...\n",
+                argv[0]);
+        return 2;
+    }
+    const char *outPath = argv[arg++];
+    const size_t frames = argc - arg;
+
+    Bytes clip = {'C', 'L', ClipFormat::WIDTH, ClipFormat::HEIGHT,
+                  (uint8_t)frames, (uint8_t)(frames >> 8), (uint8_t)frameMs, (uint8_t)(frameMs >> 8)};
+    Bytes previous(ClipFormat::FRAME_BYTES, 0);
+    Bytes decoded(ClipFormat::FRAME_BYTES, 0);
+    double totalNs = 0, maxNs = 0;
+    size_t keyframes = 0;
+
+    printf("frame,type,bytes,decode_ns\n");
+    for (size_t f = 0; f < frames; f++) {
+        Bytes frame;
+        if (!readPbm(argv[arg + f], frame)) return 1;
+
+        Bytes key = encodeRecord(frame, nullptr);
+        Bytes delta = encodeRecord(frame, &previous);
+        bool isKey = f == 0 || (keyframeEvery && f % keyframeEvery == 0) || key.size() <= delta.size();
+
+        size_t recordStart = clip.size();
+        const Bytes &record = isKey ? key : delta;
+        clip.insert(clip.end(), record.begin(), record.end());
+        keyframes += isKey;
+
+        // Round trip through the firmware decoder
+        const uint8_t *stored = clip.data() + recordStart;
+        double ns = decodeNs(stored, decoded);
+        const uint8_t *end = ClipFormat::decodeFrame(stored, decoded.data());
+        if (decoded != frame || end != clip.data() + clip.size()) {
+            fprintf(stderr, "%s: decoded frame does not match\n", argv[arg + f]);
+            return 1;
+        }
+
+        totalNs += ns;
+        maxNs = max(maxNs, ns);
+        printf("%zu,%s,%zu,%.0f\n", f, isKey ? "key" : "delta", clip.size() - recordStart, ns);
+        previous = frame;
+    }
+
+    if (!writeHeader(outPath, name, clip, frames)) return 1;
+
+    const size_t raw = frames * ClipFormat::FRAME_BYTES;
+    fprintf(stderr, "%zu frames (%zu keyframes), %zu -> %zu bytes, ratio %.1f:1, "
+                    "decode mean %.0f ns max %.0f ns per frame (host)\n",
+            frames, keyframes, raw, clip.size(), (double)raw / clip.size(),
+            totalNs / frames, maxNs);
+    return 0;
+}
@@ -0,0 +1,162 @@
+"""Turn a tokenized log stream back into text.
+
+    python tools/log_decode.py TABLE [INPUT]
+
+TABLE is the log_tokens.csv written by the build (.pio/build/<env>/). INPUT
+is a capture file or a serial port (needs pyserial); stdin when omitted.
+Plain text in the stream is passed through, 0xA5 records are decoded with
+the format string for their token (see src/Logging.h for the layout).
+"""
+
+import csv
+import re
+import struct
+import sys
+
+MARKER = 0xA5
+ESCAPE = 0xA7
+CONVERSION = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|z|j|t|L)?([diouxXeEfgGcsp%])")
+
+
+def load_table(path):
+    table = {}
+    with open(path, newline="", encoding="utf-8") as handle:
+        for row in csv.DictReader(handle):
+            table[int(row["token"], 16)] = row["format"]
+    return table
+
+
+class Reader:
+    def __init__(self, payload):
+        self.payload = payload
+        self.pos = 0
+
+    def byte(self):
+        value = self.payload[self.pos]
+        self.pos += 1
+        return value
+
+    def varint(self):
+        shift = value = 0
+        while True:
+            byte = self.byte()
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if byte < 0x80:
+                return (value >> 1) ^ -(value & 1)
+
+    def float32(self):
+        value = struct.unpack_from("<f", self.payload, self.pos)[0]
+        self.pos += 4
+        return value
+
+    def string(self):
+        count = self.byte()
+        text = self.payload[self.pos:self.pos + count].decode("utf-8", "replace")
+        self.pos += count
+        return text
+
+
+def format_record(fmt, reader):
+    out = []
+    last = 0
+    for match in CONVERSION.finditer(fmt):
+        out.append(fmt[last:match.start()])
+        last = match.end()
+        flags, width, precision, length, kind = match.groups()
+        if kind == "%":
+            out.append("%")
+            continue
+        spec = "%" + flags + (width or "") + ("." + precision if precision else "")
+        if kind in "di":
+            out.append((spec + "d") % reader.varint())
+        elif kind in "ouxXc":
+            bits = 64 if length in ("ll", "j") else 32
+            value = reader.varint() & ((1 << bits) - 1)
+            out.append((spec + kind) % (chr(value) if kind == "c" else value))
+        elif kind == "p":
+            out.append("0x%x" % (reader.varint() & 0xFFFFFFFF))
+        elif kind in "eEfgG":
+            out.append((spec + kind) % reader.float32())
+        elif kind == "s":
+            out.append((spec + "s") % reader.string())
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def unescape(buffer, count):
+    """The first count payload bytes after a record's marker, and the wire
+    bytes they took; None while the record is incomplete"""
+    out = bytearray()
+    pos = 1
+    while len(out) < count:
+        if pos >= len(buffer):
+            return None
+        byte = buffer[pos]
+        pos += 1
+        if byte == ESCAPE:
+            if pos >= len(buffer):
+                return None
+            byte = buffer[pos] ^ 0x20
+            pos += 1
+        out.append(byte)
+    return bytes(out), pos
+
+
+def decode(stream, table, write, follow=False):
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if follow:
+                continue  # Serial read timed out, keep listening
+            break
+        buffer.extend(chunk)
+        while buffer:
+            if buffer[0] != MARKER:
+                end = buffer.find(bytes([MARKER]))
+                end = len(buffer) if end < 0 else end
+                write(buffer[:end].decode("utf-8", "replace"))
+                del buffer[:end]
+                continue
+            header = unescape(buffer, 1)
+            record = header and unescape(buffer, 1 + header[0][0])
+            if record is None:
+                break  # Wait for the rest of the record
+            payload = record[0][1:]
+            del buffer[:record[1]]
+            token = struct.unpack_from("<I", payload)[0] if len(payload) >= 4 else None
+            if token not in table:
+                write("[log] unknown token %s\n" % ("%08x" % token if token is not None else "?"))
+                continue
+            try:
+                write(format_record(table[token], Reader(payload[4:])))
+            except (IndexError, struct.error):
+                write("[log] truncated record for %08x\n" % token)
+
+
+def open_input(path):
+    """Returns (stream, follow)"""
+    if path is None:
+        return sys.stdin.buffer, False
+    if path.startswith(("/dev/", "COM")):
+        import serial  # pyserial
+        return serial.Serial(path, 115200, timeout=0.1), True
+    return open(path, "rb"), False
+
+
+def main(argv):
+    if not argv or len(argv) > 2:
+        raise SystemExit(__doc__)
+    table = load_table(argv[0])
+    stream, follow = open_input(argv[1] if len(argv) > 1 else None)
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    decode(stream, table, write, follow)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
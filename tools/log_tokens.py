@@ -0,0 +1,108 @@
+"""Collect LOG_* format strings into the token table for tokenized logging.
+
+Runs as a PlatformIO pre-build script (writes log_tokens.csv into the build
+directory) or on its own:
+
+    python tools/log_tokens.py [--src src] [--out log_tokens.csv]
+
+Tokens are the 32-bit FNV-1a hash of the format string exactly as the
+compiler sees it, including the level prefix LOG_ERROR/LOG_WARN add (see
+src/Logging.h). Two different strings with the same token fail the build.
+"""
+
+import csv
+import os
+import re
+import sys
+
+LEVELS = {
+    "ERROR": (0, "[ERROR] "),
+    "WARN": (1, "[WARN] "),
+    "INFO": (2, ""),
+    "VERBOSE": (3, ""),
+}
+
+CALL = re.compile(r'\bLOG_(ERROR|WARN|INFO|VERBOSE)\s*\(\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "\\": "\\", '"': '"', "'": "'", "0": "\0"}
+
+
+def unescape(text):
+    out = []
+    i = 0
+    while i < len(text):
+        if text[i] == "\\" and i + 1 < len(text):
+            out.append(ESCAPES.get(text[i + 1], text[i + 1]))
+            i += 2
+        else:
+            out.append(text[i])
+            i += 1
+    return "".join(out)
+
+
+def fnv1a(text):
+    value = 2166136261
+    for byte in text.encode("utf-8"):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def collect(src_dir):
+    tokens = {}
+    for root, _, files in os.walk(src_dir):
+        for name in sorted(files):
+            if not name.endswith((".h", ".cpp")):
+                continue
+            path = os.path.join(root, name)
+            with open(path, encoding="utf-8") as handle:
+                source = handle.read()
+            for match in CALL.finditer(source):
+                level, prefix = LEVELS[match.group(1)]
+                literal = "".join(LITERAL.findall(match.group(2)))
+                text = prefix + unescape(literal)
+                token = fnv1a(text)
+                line = source.count("\n", 0, match.start()) + 1
+                where = "%s:%d" % (os.path.relpath(path, src_dir), line)
+                if token in tokens and tokens[token][1] != text:
+                    raise SystemExit("log token collision %08x: %r (%s) and %r (%s)"
+                                     % (token, tokens[token][1], tokens[token][2], text, where))
+                tokens.setdefault(token, (level, text, where))
+    return tokens
+
+
+def write_table(tokens, path):
+    with open(path, "w", newline="", encoding="utf-8") as handle:
+        writer = csv.writer(handle)
+        writer.writerow(["token", "level", "location", "format"])
+        for token, (level, text, where) in sorted(tokens.items(), key=lambda item: item[1][2]):
+            writer.writerow(["%08x" % token, level, where, text])
+
+
+def main(argv):
+    src_dir = "src"
+    out = "log_tokens.csv"
+    args = list(argv)
+    while args:
+        arg = args.pop(0)
+        if arg == "--src" and args:
+            src_dir = args.pop(0)
+        elif arg == "--out" and args:
+            out = args.pop(0)
+        else:
+            raise SystemExit(__doc__)
+    tokens = collect(src_dir)
+    write_table(tokens, out)
+    print("%d log tokens -> %s" % (len(tokens), out))
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+except NameError:
+    if __name__ == "__main__":
+        main(sys.argv[1:])
+else:
+    build_dir = env.subst("$BUILD_DIR")  # noqa: F821
+    os.makedirs(build_dir, exist_ok=True)
+    table = os.path.join(build_dir, "log_tokens.csv")
+    write_table(collect(env.subst("$PROJECT_SRC_DIR")), table)  # noqa: F821
+    print("Log token table: %s" % table)
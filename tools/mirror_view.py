@@ -0,0 +1,210 @@
+"""Save the framebuffer mirror stream as images.
+
+    python tools/mirror_view.py [--out DIR] [--ppm] [--scale N] [--start] [INPUT]
+
+INPUT is a capture file or a serial port (needs pyserial); stdin when
+omitted. --start sends "mirror on" to the port first. Each frame is
+written to DIR (default mirror/) as frame_NNNNN.pbm, or as a scaled
+.ppm with --ppm, numbered by the device's frame sequence. Text in the
+stream (the log) is passed through to stdout. Bandwidth, frame rate and
+drop counts go to stderr at the end and every 100 frames.
+
+Packets are described in src/FrameMirror.h, the frame records are clip
+records (src/ClipPlayer.h).
+"""
+
+import os
+import struct
+import sys
+
+MARKER = 0xA6
+KIND = ord("M")
+HEADER = struct.Struct("<BBHIH")
+WIDTH, HEIGHT = 72, 40
+PAGES = HEIGHT // 8
+FRAME_BYTES = WIDTH * PAGES
+MAX_RECORD = 1 + FRAME_BYTES + (FRAME_BYTES + 127) // 128
+
+
+def decode_record(record, frame):
+    """Apply one clip record to frame (bytearray), False if malformed"""
+    key = record[0] & 1
+    pos, out = 1, 0
+    try:
+        while out < FRAME_BYTES:
+            control = record[pos]
+            pos += 1
+            if control < 0x80:
+                count = control + 1
+                data = record[pos:pos + count]
+                pos += count
+                for i in range(min(count, FRAME_BYTES - out)):
+                    frame[out + i] = data[i] if key else frame[out + i] ^ data[i]
+            elif control < 0xC0:
+                count = (control & 0x3F) + 1
+                if key:
+                    frame[out:out + count] = bytes(min(count, FRAME_BYTES - out))
+            else:
+                count = (control & 0x3F) + 3
+                value = record[pos]
+                pos += 1
+                for i in range(min(count, FRAME_BYTES - out)):
+                    frame[out + i] = value if key else frame[out + i] ^ value
+            out += count
+    except IndexError:
+        return False
+    return pos == len(record)
+
+
+def pixel(frame, x, y):
+    return (frame[(y // 8) * WIDTH + x] >> (y & 7)) & 1
+
+
+def write_image(frame, path, ppm, scale):
+    with open(path, "wb") as handle:
+        if not ppm:
+            handle.write(b"P4\n%d %d\n" % (WIDTH, HEIGHT))
+            for y in range(HEIGHT):
+                row = bytearray((WIDTH + 7) // 8)
+                for x in range(WIDTH):
+                    if pixel(frame, x, y):
+                        row[x // 8] |= 0x80 >> (x & 7)
+                handle.write(row)
+            return
+        # Light on dark like the panel
+        on, off = b"\xd8\xf0\xff", b"\x00\x00\x00"
+        handle.write(b"P6\n%d %d\n255\n" % (WIDTH * scale, HEIGHT * scale))
+        for y in range(HEIGHT):
+            row = b"".join((on if pixel(frame, x, y) else off) * scale for x in range(WIDTH))
+            handle.write(row * scale)
+
+
+class Stats:
+    def __init__(self):
+        self.frames = self.keyframes = self.dropped = self.corrupt = 0
+        self.unsynced = self.bytes = 0
+        self.first_ms = self.last_ms = None
+
+    def report(self):
+        span = (self.last_ms - self.first_ms) / 1000.0 if self.frames > 1 else 0
+        rate = "%.1f fps, %.0f B/s (%.1f kbit/s)" % (
+            (self.frames - 1) / span, self.bytes / span, self.bytes * 8 / span / 1000) if span else "-"
+        sys.stderr.write("mirror: %d frames (%d keyframes), %d dropped on device, %d corrupt, "
+                         "%d skipped before a keyframe, %d bytes, %.1f B/frame, %s\n"
+                         % (self.frames, self.keyframes, self.dropped, self.corrupt, self.unsynced,
+                            self.bytes, self.bytes / max(self.frames, 1), rate))
+
+
+def view(stream, out_dir, ppm, scale, follow=False):
+    os.makedirs(out_dir, exist_ok=True)
+    stats = Stats()
+    frame = bytearray(FRAME_BYTES)
+    synced = False
+    last_sequence = None
+    frame_number = 0
+    buffer = bytearray()
+
+    try:
+        while True:
+            chunk = stream.read(4096)
+            if not chunk:
+                if follow:
+                    continue  # Serial read timed out, keep listening
+                break
+            buffer.extend(chunk)
+
+            while buffer:
+                if buffer[0] != MARKER:
+                    end = buffer.find(bytes([MARKER]))
+                    end = len(buffer) if end < 0 else end
+                    sys.stdout.buffer.write(buffer[:end])
+                    sys.stdout.flush()
+                    del buffer[:end]
+                    continue
+                if len(buffer) < HEADER.size:
+                    break
+                marker, kind, sequence, millis, length = HEADER.unpack_from(buffer)
+                if kind != KIND or length == 0 or length > MAX_RECORD:
+                    sys.stdout.buffer.write(buffer[:1])  # Not a packet, e.g. a log token
+                    del buffer[:1]
+                    continue
+                if len(buffer) < HEADER.size + length + 1:
+                    break
+                record = bytes(buffer[HEADER.size:HEADER.size + length])
+                checksum = buffer[HEADER.size + length]
+                check = 0
+                for byte in record:
+                    check ^= byte
+                if check != checksum:
+                    stats.corrupt += 1
+                    synced = False
+                    del buffer[:1]
+                    continue
+                del buffer[:HEADER.size + length + 1]
+
+                if last_sequence is not None:
+                    gap = (sequence - last_sequence - 1) & 0xFFFF
+                    stats.dropped += gap
+                    frame_number += gap + 1
+                last_sequence = sequence
+                stats.bytes += HEADER.size + length + 1
+
+                key = record[0] & 1
+                if not key and not synced:
+                    stats.unsynced += 1
+                    continue
+                if not decode_record(record, frame):
+                    stats.corrupt += 1
+                    synced = False
+                    continue
+                synced = True
+                stats.frames += 1
+                stats.keyframes += key
+                if stats.first_ms is None:
+                    stats.first_ms = millis
+                stats.last_ms = millis
+
+                name = "frame_%05d.%s" % (frame_number, "ppm" if ppm else "pbm")
+                write_image(frame, os.path.join(out_dir, name), ppm, scale)
+                if stats.frames % 100 == 0:
+                    stats.report()
+    except KeyboardInterrupt:
+        pass
+    stats.report()
+
+
+def main(argv):
+    out_dir, ppm, scale, start, path = "mirror", False, 4, False, None
+    args = list(argv)
+    while args:
+        arg = args.pop(0)
+        if arg == "--out" and args:
+            out_dir = args.pop(0)
+        elif arg == "--ppm":
+            ppm = True
+        elif arg == "--scale" and args:
+            scale = max(1, int(args.pop(0)))
+        elif arg == "--start":
+            start = True
+        elif not arg.startswith("--") and path is None:
+            path = arg
+        else:
+            raise SystemExit(__doc__)
+
+    follow = False
+    if path is None:
+        stream = sys.stdin.buffer
+    elif path.startswith(("/dev/", "COM")):
+        import serial  # pyserial
+        stream = serial.Serial(path, 115200, timeout=0.1)
+        follow = True
+        if start:
+            stream.write(b"mirror on\n")
+    else:
+        stream = open(path, "rb")
+
+    view(stream, out_dir, ppm, scale, follow)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])